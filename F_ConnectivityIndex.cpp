@@ -0,0 +1,406 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#include "F_ConnectivityIndex.h"
+
+#include "F_Executor.h"
+#include "G_Pathfinder.h"
+#include "M_Pathfind.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <span>
+#include <utility>
+
+using namespace Core;
+using namespace M_Pathfind;
+using namespace godot;
+
+void F_ConnectivityIndex::Build(const U_TiledDatas<uint32_t>& costDatas)
+{
+    Reset(costDatas.GetSize());
+    LabelRows(costDatas, 0, mapSize_.y);
+}
+
+void F_ConnectivityIndex::Build(const F_MutableContext& context, const U_TiledDatas<uint32_t>& costDatas)
+{
+    Reset(costDatas.GetSize());
+
+    // 각 Strip은 자기 행에 속한 타일의 Union-Find 노드만 건드리므로 워커들끼리 경합하지 않음. Strip 하나가 블록 하나이며,
+    // 호출한 스레드도 워커들과 함께 Strip을 가져가므로 워커가 없으면 호출한 스레드가 모두 처리함.
+    const auto stripCount = static_cast<size_t>((mapSize_.y + StripHeight - 1) / StripHeight);
+    context.Executor.ForEachBlock(context,
+                                  stripCount,
+                                  [this, &costDatas](const size_t stripIndex)
+                                  {
+                                      const auto beginRow = static_cast<int32_t>(stripIndex) * StripHeight;
+                                      LabelRows(costDatas, beginRow, std::min(beginRow + StripHeight, mapSize_.y));
+                                  });
+
+    for (int32_t row = StripHeight; row < mapSize_.y; row += StripHeight)
+    {
+        for (int32_t x = 0; x < mapSize_.x; ++x)
+        {
+            const auto label = labels_[GetTileIndex(Vector2i{ x, row })];
+            if (label == NullLabel)
+            {
+                continue;
+            }
+
+            for (int32_t offsetX = -1; offsetX <= 1; ++offsetX)
+            {
+                const auto upperPosition = Vector2i{ x + offsetX, row - 1 };
+                if (!IsValidPosition(mapSize_, upperPosition))
+                {
+                    continue;
+                }
+
+                const auto upperLabel = labels_[GetTileIndex(upperPosition)];
+                if (upperLabel != NullLabel)
+                {
+                    Unite(label, upperLabel);
+                }
+            }
+        }
+    }
+}
+
+void F_ConnectivityIndex::OnCostsChanged(const U_TiledDatas<uint32_t>& costDatas, const Rect2i& dirtyRect)
+{
+    // 열림, 분리가 반복되며 쌓인 노드가 타일 수의 두 배를 넘으면 다시 라벨링하는 편이 이후 탐색에 유리함.
+    if (costDatas.GetSize() != mapSize_ || parents_.size() > 2 * labels_.size())
+    {
+        Build(costDatas);
+        return;
+    }
+
+    const auto dirtyEnd = dirtyRect.get_end();
+    for (int32_t y = std::max(dirtyRect.position.y, 0); y < std::min(dirtyEnd.y, mapSize_.y); ++y)
+    {
+        for (int32_t x = std::max(dirtyRect.position.x, 0); x < std::min(dirtyEnd.x, mapSize_.x); ++x)
+        {
+            const auto position = Vector2i{ x, y };
+            const bool wasOpened = labels_[GetTileIndex(position)] != NullLabel;
+            const bool isOpened = IsPassable(costDatas, position);
+            if (!wasOpened && isOpened)
+            {
+                OnTileOpened(costDatas, position);
+            }
+            else if (wasOpened && !isOpened)
+            {
+                OnTileClosed(costDatas, position);
+            }
+        }
+    }
+}
+
+bool F_ConnectivityIndex::IsConnected(const Vector2i& from, const Vector2i& to) const
+{
+    if (!IsValidPosition(mapSize_, from) || !IsValidPosition(mapSize_, to))
+    {
+        return false;
+    }
+
+    const auto fromLabel = labels_[GetTileIndex(from)];
+    const auto toLabel = labels_[GetTileIndex(to)];
+    return fromLabel != NullLabel && toLabel != NullLabel && FindRoot(fromLabel) == FindRoot(toLabel);
+}
+
+bool F_ConnectivityIndex::IsPassable(const U_TiledDatas<uint32_t>& costDatas, const Vector2i& position)
+{
+    return costDatas.GetDataAt(position) != G_Pathfinder::ImpassableCost;
+}
+
+uint32_t F_ConnectivityIndex::FindRoot(uint32_t node) const
+{
+    // 여러 스레드에서 동시에 조회될 수 있으므로 경로 압축을 하지 않음. 깊이는 Rank에 의해 O(log n)으로 유지됨.
+    while (parents_[node] != node)
+    {
+        node = parents_[node];
+    }
+    return node;
+}
+
+uint32_t F_ConnectivityIndex::FindRootAndCompress(uint32_t node)
+{
+    while (parents_[node] != node)
+    {
+        parents_[node] = parents_[parents_[node]];
+        node = parents_[node];
+    }
+    return node;
+}
+
+void F_ConnectivityIndex::Unite(const uint32_t lhsNode, const uint32_t rhsNode)
+{
+    auto lhsRoot = FindRootAndCompress(lhsNode);
+    auto rhsRoot = FindRootAndCompress(rhsNode);
+    if (lhsRoot == rhsRoot)
+    {
+        return;
+    }
+
+    if (ranks_[lhsRoot] < ranks_[rhsRoot])
+    {
+        std::swap(lhsRoot, rhsRoot);
+    }
+    parents_[rhsRoot] = lhsRoot;
+    if (ranks_[lhsRoot] == ranks_[rhsRoot])
+    {
+        ranks_[lhsRoot] += 1;
+    }
+}
+
+uint32_t F_ConnectivityIndex::CreateNode()
+{
+    const auto node = static_cast<uint32_t>(parents_.size());
+    parents_.push_back(node);
+    ranks_.push_back(0);
+    return node;
+}
+
+void F_ConnectivityIndex::Reset(const Vector2i& mapSize)
+{
+    mapSize_ = mapSize;
+    const auto tileCount = static_cast<size_t>(mapSize.x) * mapSize.y;
+    labels_.assign(tileCount, NullLabel);
+    parents_.assign(tileCount, 0);
+    ranks_.assign(tileCount, 0);
+    visitVersions_.assign(tileCount, 0);
+    visitFronts_.assign(tileCount, 0);
+    visitVersion_ = 0;
+}
+
+void F_ConnectivityIndex::LabelRows(const U_TiledDatas<uint32_t>& costDatas, const int32_t beginRow, const int32_t endRow)
+{
+    // 래스터 순서로 진행하며, 이미 라벨링된 왼쪽과 위쪽 세 이웃과만 합치면 8방향 연결이 모두 반영됨.
+    constexpr std::array<std::pair<int32_t, int32_t>, 4> PreviousOffsets{ { { -1, 0 }, { -1, -1 }, { 0, -1 }, { 1, -1 } } };
+
+    for (int32_t y = beginRow; y < endRow; ++y)
+    {
+        for (int32_t x = 0; x < mapSize_.x; ++x)
+        {
+            const auto position = Vector2i{ x, y };
+            const auto tileIndex = GetTileIndex(position);
+            if (!IsPassable(costDatas, position))
+            {
+                labels_[tileIndex] = NullLabel;
+                continue;
+            }
+
+            parents_[tileIndex] = tileIndex;
+            labels_[tileIndex] = tileIndex;
+            for (const auto& [offsetX, offsetY] : PreviousOffsets)
+            {
+                const auto previousPosition = position + Vector2i{ offsetX, offsetY };
+                if (previousPosition.y < beginRow || !IsValidPosition(mapSize_, previousPosition))
+                {
+                    continue;
+                }
+
+                const auto previousLabel = labels_[GetTileIndex(previousPosition)];
+                if (previousLabel != NullLabel)
+                {
+                    Unite(tileIndex, previousLabel);
+                }
+            }
+        }
+    }
+}
+
+void F_ConnectivityIndex::OnTileOpened(const U_TiledDatas<uint32_t>&, const Vector2i& position)
+{
+    const auto node = CreateNode();
+    labels_[GetTileIndex(position)] = node;
+    for (const auto& [offsetX, offsetY] : DirectionOffsets)
+    {
+        const auto nearPosition = position + Vector2i{ offsetX, offsetY };
+        if (!IsValidPosition(mapSize_, nearPosition))
+        {
+            continue;
+        }
+
+        const auto nearLabel = labels_[GetTileIndex(nearPosition)];
+        if (nearLabel != NullLabel)
+        {
+            Unite(node, nearLabel);
+        }
+    }
+}
+
+void F_ConnectivityIndex::OnTileClosed(const U_TiledDatas<uint32_t>&, const Vector2i& position)
+{
+    labels_[GetTileIndex(position)] = NullLabel;
+
+    std::array<Vector2i, MaxNeighborCount> openedNeighbors;
+    std::array<uint8_t, MaxNeighborCount> neighborFronts;
+    uint8_t openedNeighborCount = 0;
+    for (const auto& [offsetX, offsetY] : DirectionOffsets)
+    {
+        const auto nearPosition = position + Vector2i{ offsetX, offsetY };
+        if (IsValidPosition(mapSize_, nearPosition) && labels_[GetTileIndex(nearPosition)] != NullLabel)
+        {
+            openedNeighbors[openedNeighborCount] = nearPosition;
+            openedNeighborCount += 1;
+        }
+    }
+
+    // 서로 맞닿아 있는 이웃들은 닫힌 타일 없이도 연결되어 있으므로 하나의 Front로 묶음.
+    uint8_t frontCount = 0;
+    for (uint8_t neighborIndex = 0; neighborIndex < openedNeighborCount; ++neighborIndex)
+    {
+        neighborFronts[neighborIndex] = frontCount;
+        for (uint8_t previousIndex = 0; previousIndex < neighborIndex; ++previousIndex)
+        {
+            const auto difference = openedNeighbors[neighborIndex] - openedNeighbors[previousIndex];
+            if (std::abs(difference.x) <= 1 && std::abs(difference.y) <= 1)
+            {
+                const auto mergedFront = std::min(neighborFronts[neighborIndex], neighborFronts[previousIndex]);
+                const auto removedFront = std::max(neighborFronts[neighborIndex], neighborFronts[previousIndex]);
+                for (uint8_t index = 0; index <= neighborIndex; ++index)
+                {
+                    if (neighborFronts[index] == removedFront)
+                    {
+                        neighborFronts[index] = mergedFront;
+                    }
+                }
+            }
+        }
+
+        if (neighborFronts[neighborIndex] == frontCount)
+        {
+            frontCount += 1;
+        }
+    }
+
+    if (frontCount <= 1)
+    {
+        return;
+    }
+
+    visitVersion_ += 1;
+    if (visitVersion_ == 0)
+    {
+        std::ranges::fill(visitVersions_, 0);
+        visitVersion_ = 1;
+    }
+
+    // neighborFronts는 병합 과정에서 번호가 비어 있을 수 있으므로 0부터 다시 매김.
+    std::array<uint8_t, MaxNeighborCount> compactFronts;
+    compactFronts.fill(0xff);
+    uint8_t compactFrontCount = 0;
+    splitFronts_.resize(std::max(splitFronts_.size(), static_cast<size_t>(frontCount)));
+    for (uint8_t neighborIndex = 0; neighborIndex < openedNeighborCount; ++neighborIndex)
+    {
+        auto& compactFront = compactFronts[neighborFronts[neighborIndex]];
+        if (compactFront == 0xff)
+        {
+            compactFront = compactFrontCount;
+            splitFronts_[compactFront].Tiles.clear();
+            splitFronts_[compactFront].Head = 0;
+            splitFronts_[compactFront].Group = compactFront;
+            compactFrontCount += 1;
+        }
+
+        const auto tileIndex = GetTileIndex(openedNeighbors[neighborIndex]);
+        visitVersions_[tileIndex] = visitVersion_;
+        visitFronts_[tileIndex] = compactFront;
+        splitFronts_[compactFront].Tiles.push_back(tileIndex);
+    }
+
+    const auto findGroup = [this](uint32_t front)
+    {
+        while (splitFronts_[front].Group != front)
+        {
+            front = splitFronts_[front].Group;
+        }
+        return front;
+    };
+
+    // 모든 Front가 한 단계씩 번갈아 확장하므로, 비용은 분리된 작은 쪽의 크기에 비례함.
+    std::array<bool, MaxNeighborCount> isGroupResolved{};
+    uint32_t unresolvedGroupCount = compactFrontCount;
+    while (unresolvedGroupCount > 1)
+    {
+        for (uint32_t front = 0; front < compactFrontCount; ++front)
+        {
+            auto& splitFront = splitFronts_[front];
+            if (splitFront.Head == splitFront.Tiles.size())
+            {
+                continue;
+            }
+
+            const auto currentPosition = GetTilePosition(splitFront.Tiles[splitFront.Head]);
+            splitFront.Head += 1;
+            for (const auto& [offsetX, offsetY] : DirectionOffsets)
+            {
+                const auto nearPosition = currentPosition + Vector2i{ offsetX, offsetY };
+                if (!IsValidPosition(mapSize_, nearPosition))
+                {
+                    continue;
+                }
+
+                const auto nearTileIndex = GetTileIndex(nearPosition);
+                if (labels_[nearTileIndex] == NullLabel)
+                {
+                    continue;
+                }
+
+                if (visitVersions_[nearTileIndex] != visitVersion_)
+                {
+                    visitVersions_[nearTileIndex] = visitVersion_;
+                    visitFronts_[nearTileIndex] = static_cast<uint8_t>(front);
+                    splitFront.Tiles.push_back(nearTileIndex);
+                    continue;
+                }
+
+                const auto currentGroup = findGroup(front);
+                const auto nearGroup = findGroup(visitFronts_[nearTileIndex]);
+                if (currentGroup != nearGroup)
+                {
+                    splitFronts_[nearGroup].Group = currentGroup;
+                    unresolvedGroupCount -= 1;
+                }
+            }
+        }
+
+        for (uint32_t group = 0; group < compactFrontCount && unresolvedGroupCount > 1; ++group)
+        {
+            if (isGroupResolved[group] || findGroup(group) != group)
+            {
+                continue;
+            }
+
+            const bool isExhausted = std::ranges::all_of(
+                std::span{ splitFronts_.data(), compactFrontCount },
+                [this, &findGroup, group](const SplitFront& splitFront)
+                {
+                    return findGroup(static_cast<uint32_t>(&splitFront - splitFronts_.data())) != group
+                           || splitFront.Head == splitFront.Tiles.size();
+                });
+            if (!isExhausted)
+            {
+                continue;
+            }
+
+            // 더 확장할 타일 없이 끝난 그룹은 나머지와 분리된 요소이므로 새 노드로 라벨링.
+            isGroupResolved[group] = true;
+            unresolvedGroupCount -= 1;
+            const auto node = CreateNode();
+            for (uint32_t front = 0; front < compactFrontCount; ++front)
+            {
+                if (findGroup(front) != group)
+                {
+                    continue;
+                }
+
+                for (const auto tileIndex : splitFronts_[front].Tiles)
+                {
+                    labels_[tileIndex] = node;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_F_CONNECTIVITYINDEX_H
+#define CORE_F_CONNECTIVITYINDEX_H
+
+#include "U_TiledDatas.h"
+#include <godot_cpp/variant/rect2i.hpp>
+#include <godot_cpp/variant/vector2i.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Core
+{
+    struct F_MutableContext;
+
+    /**
+     * 통행 가능한 타일들의 연결 요소(8방향)를 Union-Find로 유지하는 인덱스.
+     * 타일이 열리면 이웃 요소들과 합치기만 하고, 타일이 닫히면 닫힌 타일 주변에서만 동시 BFS를 진행하여 실제로 분리된 작은 쪽만 다시 라벨링하므로,
+     * 지형이 바뀔 때마다 맵 전체를 Flood Fill 할 필요가 없음.
+     * @remarks 갱신(Build, OnCostsChanged)은 메인 스레드에서만, 다른 스레드의 IsConnected()와 겹치지 않는 시점에 호출할 것.
+     */
+    class F_ConnectivityIndex final
+    {
+    public:
+        explicit F_ConnectivityIndex() = default;
+
+        /**
+         * 전체 맵을 메인 스레드에서 라벨링.
+         * @param costDatas
+         */
+        void Build(const U_TiledDatas<uint32_t>& costDatas);
+
+        /**
+         * 전체 맵을 행 단위 Strip으로 나누어 워커 스레드들이 각자 라벨링한 후, Strip 경계만 메인 스레드에서 이어 붙임.
+         * @param context
+         * @param costDatas
+         */
+        void Build(const F_MutableContext& context, const U_TiledDatas<uint32_t>& costDatas);
+
+        /**
+         * dirtyRect 내에서 통행 가능 여부가 바뀐 타일들을 찾아 연결 요소를 갱신.
+         * @param costDatas 변경이 이미 반영된 비용 데이터
+         * @param dirtyRect
+         */
+        void OnCostsChanged(const U_TiledDatas<uint32_t>& costDatas, const godot::Rect2i& dirtyRect);
+
+        [[nodiscard]]
+        bool IsConnected(const godot::Vector2i& from, const godot::Vector2i& to) const;
+
+    private:
+        static constexpr uint32_t NullLabel = 0xffffffff;
+        static constexpr int32_t StripHeight = 32;
+        static constexpr uint8_t MaxNeighborCount = 8;
+
+        /**
+         * 타일이 닫힐 때 분리 여부를 확인하기 위한 BFS 하나. 닫힌 타일의 이웃 중 서로 인접한 타일들이 하나의 Front를 이룸.
+         */
+        struct SplitFront
+        {
+            std::vector<uint32_t> Tiles; // 방문한 타일들. [Head, size)는 아직 확장하지 않은 타일.
+            size_t Head;
+            uint32_t Group;
+        };
+
+        godot::Vector2i mapSize_;
+        std::vector<uint32_t> labels_; // 타일 인덱스 -> Union-Find 노드. 닫힌 타일은 NullLabel.
+        std::vector<uint32_t> parents_;
+        std::vector<uint8_t> ranks_;
+
+        std::vector<uint32_t> visitVersions_;
+        std::vector<uint8_t> visitFronts_;
+        uint32_t visitVersion_{ 0 };
+        std::vector<SplitFront> splitFronts_;
+
+        [[nodiscard]]
+        static bool IsPassable(const U_TiledDatas<uint32_t>& costDatas, const godot::Vector2i& position);
+
+        [[nodiscard]]
+        uint32_t GetTileIndex(const godot::Vector2i& position) const
+        {
+            return static_cast<uint32_t>(position.y * mapSize_.x + position.x);
+        }
+
+        [[nodiscard]]
+        godot::Vector2i GetTilePosition(const uint32_t tileIndex) const
+        {
+            return godot::Vector2i{ static_cast<int32_t>(tileIndex % mapSize_.x), static_cast<int32_t>(tileIndex / mapSize_.x) };
+        }
+
+        [[nodiscard]]
+        uint32_t FindRoot(uint32_t node) const;
+
+        [[nodiscard]]
+        uint32_t FindRootAndCompress(uint32_t node);
+
+        void Unite(uint32_t lhsNode, uint32_t rhsNode);
+
+        uint32_t CreateNode();
+
+        void Reset(const godot::Vector2i& mapSize);
+
+        void LabelRows(const U_TiledDatas<uint32_t>& costDatas, int32_t beginRow, int32_t endRow);
+
+        void OnTileOpened(const U_TiledDatas<uint32_t>& costDatas, const godot::Vector2i& position);
+
+        void OnTileClosed(const U_TiledDatas<uint32_t>& costDatas, const godot::Vector2i& position);
+    };
+}
+
+#endif // CORE_F_CONNECTIVITYINDEX_H
@@ -0,0 +1,272 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_F_TASK_H
+#define CORE_F_TASK_H
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace Core
+{
+    /**
+     * 코루틴 프레임용 스레드별 메모리 풀. 프레임 크기를 SizeClassUnit 단위로 올려 크기별 free list에서 재사용함.
+     * 코루틴은 다른 워커에서 재개되어 끝날 수 있으므로, 해제는 해제한 스레드의 free list로 돌아감.
+     */
+    class F_CoroutineFramePool final
+    {
+    public:
+        static void* Allocate(size_t size);
+
+        static void Deallocate(void* frame, size_t size);
+
+    private:
+        static constexpr size_t SizeClassUnit = 64;
+        static constexpr size_t SizeClassCount = 32; // SizeClassUnit * SizeClassCount보다 큰 프레임은 힙에서 직접 할당.
+        static constexpr uint32_t MaxCachedFrameCount = 256; // 크기별로 한 스레드가 쌓아 둘 수 있는 최대 프레임 수.
+
+        struct FreeFrame
+        {
+            FreeFrame* Next;
+        };
+
+        struct ThreadCache
+        {
+            std::array<FreeFrame*, SizeClassCount> FreeLists{};
+            std::array<uint32_t, SizeClassCount> FreeCounts{};
+
+            ~ThreadCache();
+        };
+
+        static thread_local ThreadCache Cache;
+    };
+
+    inline thread_local F_CoroutineFramePool::ThreadCache F_CoroutineFramePool::Cache;
+
+    inline void* F_CoroutineFramePool::Allocate(const size_t size)
+    {
+        const auto sizeClass = (size + SizeClassUnit - 1) / SizeClassUnit;
+        if (sizeClass == 0 || sizeClass > SizeClassCount)
+        {
+            return ::operator new(size);
+        }
+
+        auto& freeList = Cache.FreeLists[sizeClass - 1];
+        if (!freeList)
+        {
+            return ::operator new(sizeClass * SizeClassUnit);
+        }
+
+        const auto frame = freeList;
+        freeList = frame->Next;
+        Cache.FreeCounts[sizeClass - 1] -= 1;
+        return frame;
+    }
+
+    inline void F_CoroutineFramePool::Deallocate(void* frame, const size_t size)
+    {
+        const auto sizeClass = (size + SizeClassUnit - 1) / SizeClassUnit;
+        if (sizeClass == 0 || sizeClass > SizeClassCount || Cache.FreeCounts[sizeClass - 1] >= MaxCachedFrameCount)
+        {
+            ::operator delete(frame);
+            return;
+        }
+
+        Cache.FreeLists[sizeClass - 1] = new(frame) FreeFrame{ Cache.FreeLists[sizeClass - 1] };
+        Cache.FreeCounts[sizeClass - 1] += 1;
+    }
+
+    inline F_CoroutineFramePool::ThreadCache::~ThreadCache()
+    {
+        for (auto freeFrame : FreeLists)
+        {
+            while (freeFrame)
+            {
+                const auto next = freeFrame->Next;
+                ::operator delete(freeFrame);
+                freeFrame = next;
+            }
+        }
+    }
+
+    /**
+     * F_Task들의 promise 공통 부분. 프레임은 F_CoroutineFramePool에서 할당하며, 끝나면 자신을 co_await한 코루틴을 바로 이어서 재개함.
+     */
+    class F_TaskPromiseBase
+    {
+    public:
+        struct FinalAwaiter final
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template<typename TPromise>
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<TPromise> handle) const noexcept
+            {
+                const auto continuation = handle.promise().Continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        std::coroutine_handle<> Continuation;
+
+        static void* operator new(const size_t size)
+        {
+            return F_CoroutineFramePool::Allocate(size);
+        }
+
+        static void operator delete(void* frame, const size_t size)
+        {
+            F_CoroutineFramePool::Deallocate(frame, size);
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        FinalAwaiter final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    template<typename TResult>
+    class F_TaskPromise : public F_TaskPromiseBase
+    {
+    public:
+        void return_value(TResult result)
+        {
+            result_.emplace(std::move(result));
+        }
+
+        TResult TakeResult()
+        {
+            return std::move(*result_);
+        }
+
+    private:
+        std::optional<TResult> result_;
+    };
+
+    template<>
+    class F_TaskPromise<void> : public F_TaskPromiseBase
+    {
+    public:
+        void return_void() const noexcept
+        {
+        }
+
+        void TakeResult() const noexcept
+        {
+        }
+    };
+
+    /**
+     * F_Executor에서 실행되는 코루틴. 생성 시에는 실행되지 않고, F_Executor::Spawn()에 넘기거나 다른 F_Task 안에서 co_await할 때 시작됨.
+     * co_await한 쪽은 이 작업이 끝나면 같은 스레드에서 곧바로 재개됨.
+     * @tparam TResult co_return할 값의 타입.
+     */
+    template<typename TResult = void>
+    class [[nodiscard]] F_Task final
+    {
+    public:
+        class promise_type final : public F_TaskPromise<TResult>
+        {
+        public:
+            F_Task get_return_object()
+            {
+                return F_Task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+        };
+
+        F_Task(F_Task&& other) noexcept
+            : handle_{ std::exchange(other.handle_, nullptr) }
+        {
+        }
+
+        ~F_Task()
+        {
+            if (handle_)
+            {
+                handle_.destroy();
+            }
+        }
+
+        F_Task(const F_Task&) = delete;
+
+        F_Task& operator=(const F_Task&) = delete;
+
+        F_Task& operator=(F_Task&&) = delete;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> continuation) noexcept
+        {
+            handle_.promise().Continuation = continuation;
+            return handle_;
+        }
+
+        TResult await_resume()
+        {
+            return handle_.promise().TakeResult();
+        }
+
+    private:
+        explicit F_Task(const std::coroutine_handle<promise_type> handle)
+            : handle_{ handle }
+        {
+        }
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    /**
+     * F_Executor::Spawn()이 최상위 F_Task를 실행하기 위해 만드는 코루틴. 끝나면 스스로 프레임을 해제함.
+     */
+    struct F_DetachedTask final
+    {
+        class promise_type final : public F_TaskPromiseBase
+        {
+        public:
+            F_DetachedTask get_return_object()
+            {
+                return F_DetachedTask{ std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_never final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void return_void() const noexcept
+            {
+            }
+        };
+
+        std::coroutine_handle<promise_type> Handle;
+    };
+}
+
+#endif // CORE_F_TASK_H
@@ -9,6 +9,7 @@
 #include "U_Hash.h"
 #include "F_Map.h"
 #include "F_Pathfinder.h"
+#include <algorithm>
 #include <thread>
 #include <iostream>
 
@@ -17,11 +18,13 @@ F_SystemManager::F_SystemManager(F_EntityManager& entityManagerRef,
                                  const int threadCount)
     : EntityManagerRef{ entityManagerRef },
       EventManagerRef{ eventManagerRef },
+      applyJobCursor_{ 0 },
+      isApplyPhase_{ false },
       ThreadCount{ threadCount },
       calculateThreadContexts_{ static_cast<size_t>(threadCount + 1) },
       workingThreadCount_{ 0 },
       mainThreadPathfinder_{ *entityManagerRef.GetGlobalObject<F_Map>("F_Map"_h), 0 },
-      currentMultithreadWorkCursor_{ 0, nullptr, 0 },
+      multithreadWorkCursor_{ 0 },
       currentDeltaTime_{ 0.0 },
       currentDeltaTicks_{ 0 },
       currentTick_{ 0 }
@@ -44,27 +47,15 @@ void F_SystemManager::Update(const double deltaTime, const uint64_t deltaTicks,
     currentTick_ = currentTick;
     if (!multiThreadedSystemBlueprints_.empty())
     {
-        const auto rawComponentContainerPtr = EntityManagerRef.GetRawComponentContainer(multiThreadedSystemBlueprints_[0]
-                                                                                            .second
-                                                                                            .AxisComponentTypeIndex);
-        currentMultithreadWorkCursor_.SystemIndex = 0;
-        currentMultithreadWorkCursor_.EntityComponentMemoryPoolPtr = (rawComponentContainerPtr
-                                                                      != nullptr ? &rawComponentContainerPtr->GetMemoryPool() : nullptr);
-        workDone_.store(false, std::memory_order_relaxed);
-        workingThreadCount_.store(ThreadCount, std::memory_order_relaxed);
-        for (auto& calculateThreadContext : calculateThreadContexts_)
+        for (size_t systemIndex = 0; systemIndex < multiThreadedSystemBlueprints_.size(); ++systemIndex)
         {
-            calculateThreadContext.Working.store(true, std::memory_order_release);
-            calculateThreadContext.Working.notify_one();
-        }
-    }
-
-    if (!multiThreadedSystemBlueprints_.empty())
-    {
-        while (!workDone_.load(std::memory_order_relaxed))
-        {
-            workDone_.wait(false, std::memory_order_acquire);
+            const auto rawComponentContainerPtr = EntityManagerRef.GetRawComponentContainer(
+                multiThreadedSystemBlueprints_[systemIndex].second.AxisComponentTypeIndex);
+            axisMemoryPools_[systemIndex] = (rawComponentContainerPtr != nullptr ? &rawComponentContainerPtr->GetMemoryPool() : nullptr);
         }
+        multithreadWorkCursor_.store(0, std::memory_order_relaxed);
+        WakeCalculateThreads();
+        WaitCalculateThreads();
     }
 
     for (auto kv : singleThreadedSystemBlueprints_)
@@ -77,20 +68,45 @@ void F_SystemManager::Update(const double deltaTime, const uint64_t deltaTicks,
                                                               currentTick });
     }
 
-    for (auto kv : multiThreadedSystemBlueprints_)
+    // 묶음 안의 시스템들은 쓰는 컴포넌트가 겹치지 않으므로 워커들과 함께 동시에 Apply하고, 묶음 사이는 등록 순서대로 진행.
+    for (size_t waveIndex = 0; waveIndex + 1 < applyWaveBegins_.size(); ++waveIndex)
     {
-        kv.second
-            .ApplyFunction(F_ApplyParams{ F_RevisionDataReadContext{ revisionDataFirstNodes_.at(kv.first) },
-                                          EntityManagerRef,
-                                          EventManagerRef,
-                                          mainThreadPathfinder_,
-                                          deltaTime,
-                                          deltaTicks,
-                                          currentTick });
-        kv.second.ReleaseRevisionDataNodeFunction(revisionDataFirstNodes_.at(kv.first));
-        revisionDataFirstNodes_.at(kv.first) = nullptr;
-    }
+        applyJobs_.clear();
+        for (auto systemIndex = applyWaveBegins_[waveIndex]; systemIndex < applyWaveBegins_[waveIndex + 1]; ++systemIndex)
+        {
+            if (!multiThreadedSystemApplyDeclarations_[systemIndex].IsPartitionedByEntity)
+            {
+                applyJobs_.push_back(ApplyJob{ systemIndex, AllThreads });
+                continue;
+            }
+
+            const auto jobCountBefore = applyJobs_.size();
+            for (int threadId = 0; threadId <= ThreadCount; ++threadId)
+            {
+                if (GetRevisionDataFirstNode(threadId, systemIndex).load(std::memory_order_relaxed) != nullptr)
+                {
+                    applyJobs_.push_back(ApplyJob{ systemIndex, threadId });
+                }
+            }
+            if (applyJobs_.size() == jobCountBefore)
+            {
+                applyJobs_.push_back(ApplyJob{ systemIndex, ThreadCount });
+            }
+        }
+
+        applyJobCursor_.store(0, std::memory_order_relaxed);
+        if (applyJobs_.size() <= 1 || ThreadCount == 0)
+        {
+            RunApplyJobs(mainThreadPathfinder_);
+            continue;
+        }
 
+        isApplyPhase_.store(true, std::memory_order_relaxed);
+        WakeCalculateThreads();
+        RunApplyJobs(mainThreadPathfinder_);
+        WaitCalculateThreads();
+        isApplyPhase_.store(false, std::memory_order_relaxed);
+    }
 }
 
 void F_SystemManager::CalculateThreadBody(const int threadId)
@@ -109,64 +125,56 @@ void F_SystemManager::CalculateThreadBody(const int threadId)
             break;
         }
 
-        { // shared lock scope
-            std::shared_lock<std::shared_mutex> sharedLock(currentMultithreadWorkCursorMutex_);
-            const int currentSystemIndex = currentMultithreadWorkCursor_.SystemIndex;
-            if (currentMultithreadWorkCursor_.SystemIndex == multiThreadedSystemBlueprints_.size())
-            {
-                calculateThreadContext.Working.store(false, std::memory_order_release);
-                if (workingThreadCount_.fetch_add(-1, std::memory_order_acq_rel) == 1)
-                {
-                    workDone_.store(true, std::memory_order_release);
-                    workDone_.notify_one();
-                }
-                continue;
-            }
+        if (isApplyPhase_.load(std::memory_order_relaxed))
+        {
+            RunApplyJobs(pathfinder);
+            FinishCalculateThreadWork(calculateThreadContext);
+            continue;
+        }
 
-            const auto memoryPoolBlockCount = (currentMultithreadWorkCursor_.EntityComponentMemoryPoolPtr != nullptr ?
-                                               currentMultithreadWorkCursor_.EntityComponentMemoryPoolPtr
-                                                   ->GetPageCount()
-                                               * currentMultithreadWorkCursor_.EntityComponentMemoryPoolPtr
-                                                   ->BlocksPerPage : 0);
-            const auto memoryBlockIndex = currentMultithreadWorkCursor_.EntityComponentMemoryBlockIndex
-                .fetch_add(1, std::memory_order_relaxed);
+        // 상위 32비트는 시스템 Index, 하위 32비트는 블록 Index. 잠금 없이 fetch_add 한 번으로 블록 묶음을 가져옴.
+        const auto workCursor = multithreadWorkCursor_.fetch_add(BlocksPerClaim, std::memory_order_relaxed);
+        const auto currentSystemIndex = static_cast<size_t>(workCursor >> 32);
+        if (currentSystemIndex >= multiThreadedSystemBlueprints_.size())
+        {
+            FinishCalculateThreadWork(calculateThreadContext);
+            continue;
+        }
 
-            if (currentMultithreadWorkCursor_.EntityComponentMemoryPoolPtr == nullptr
-                || memoryBlockIndex >= memoryPoolBlockCount)
+        const F_MemoryPool* const memoryPoolPtr = axisMemoryPools_[currentSystemIndex];
+        const auto memoryPoolBlockCount = (memoryPoolPtr != nullptr ?
+                                           memoryPoolPtr->GetPageCount() * memoryPoolPtr->BlocksPerPage : 0);
+        const auto claimBeginIndex = static_cast<uint32_t>(workCursor);
+        if (claimBeginIndex >= memoryPoolBlockCount)
+        {
+            // 블록이 바닥난 시스템이면 다음 시스템으로. 다른 스레드가 먼저 넘겼다면 CAS가 실패하며 그대로 둠.
+            auto expectedWorkCursor = multithreadWorkCursor_.load(std::memory_order_relaxed);
+            while ((expectedWorkCursor >> 32) == currentSystemIndex
+                   && !multithreadWorkCursor_.compare_exchange_weak(expectedWorkCursor,
+                                                                    (currentSystemIndex + 1) << 32,
+                                                                    std::memory_order_relaxed))
             {
-                sharedLock.unlock();
-                std::unique_lock<std::shared_mutex> uniqueLock(currentMultithreadWorkCursorMutex_);
-                if (currentMultithreadWorkCursor_.SystemIndex == currentSystemIndex)
-                {
-                    currentMultithreadWorkCursor_.SystemIndex += 1;
-                    const auto rawComponentContainerPtr = (currentSystemIndex + 1
-                                                           < multiThreadedSystemBlueprints_.size() ? EntityManagerRef.GetRawComponentContainer(
-                        multiThreadedSystemBlueprints_[currentSystemIndex + 1].second
-                            .AxisComponentTypeIndex) : nullptr);
-                    currentMultithreadWorkCursor_.EntityComponentMemoryPoolPtr = (rawComponentContainerPtr
-                                                                                  != nullptr ? &rawComponentContainerPtr
-                        ->GetMemoryPool() : nullptr);
-                    currentMultithreadWorkCursor_.EntityComponentMemoryBlockIndex.store(0, std::memory_order_relaxed);
-                }
-                continue;
             }
+            continue;
+        }
 
-            const void* const memoryBlockPtr = currentMultithreadWorkCursor_.EntityComponentMemoryPoolPtr
-                ->GetMemoryBlockByIndex(memoryBlockIndex);
+        const ProcessFunction processFunction = multiThreadedSystemBlueprints_[currentSystemIndex].second
+            .ProcessFunction;
+        const F_RevisionDataWriteContext revisionDataWriteContext{ GetRevisionDataFirstNode(threadId, currentSystemIndex) };
+        const auto claimEndIndex = std::min<size_t>(claimBeginIndex + BlocksPerClaim, memoryPoolBlockCount);
+        for (auto memoryBlockIndex = claimBeginIndex; memoryBlockIndex < claimEndIndex; ++memoryBlockIndex)
+        {
+            const void* const memoryBlockPtr = memoryPoolPtr->GetMemoryBlockByIndex(memoryBlockIndex);
             if (memoryBlockPtr == nullptr)
             {
-
                 continue;
             }
+
             const F_Entity axisComponentOwnerEntity = *reinterpret_cast<const F_Entity*>(memoryBlockPtr);
             const void* const axisComponentPtr = (static_cast<const char*>(memoryBlockPtr) + sizeof(F_Entity));
-            const std::type_index currentSystemTypeIndex = multiThreadedSystemBlueprints_[currentSystemIndex].first;
-            const ProcessFunction processFunction = multiThreadedSystemBlueprints_[currentSystemIndex].second
-                .ProcessFunction;
             processFunction(F_ProcessParams{ axisComponentPtr,
                                              axisComponentOwnerEntity,
-                                             F_RevisionDataWriteContext{ revisionDataFirstNodes_.at(
-                                                 currentSystemTypeIndex) },
+                                             revisionDataWriteContext,
                                              pathfinder,
                                              EntityManagerRef,
                                              currentDeltaTime_,
@@ -176,3 +184,131 @@ void F_SystemManager::CalculateThreadBody(const int threadId)
     }
     std::cout << "Thread " << threadId << " exit" << std::endl;
 }
+
+std::atomic<F_RevisionDataNode*>& F_SystemManager::GetRevisionDataFirstNode(const int threadId, const size_t systemIndex)
+{
+    return revisionDataHeads_[threadId * multiThreadedSystemBlueprints_.size() + systemIndex].FirstNode;
+}
+
+void F_SystemManager::BuildApplyWaves()
+{
+    applyWaveBegins_.clear();
+    std::vector<std::type_index> waveWriteComponentTypeIndices;
+    bool isWaveExclusive = false;
+    for (size_t systemIndex = 0; systemIndex < multiThreadedSystemApplyDeclarations_.size(); ++systemIndex)
+    {
+        const auto& applyDeclaration = multiThreadedSystemApplyDeclarations_[systemIndex];
+        const bool isConflicting = applyWaveBegins_.empty()
+                                   || isWaveExclusive
+                                   || !applyDeclaration.IsWriteSetDeclared
+                                   || std::ranges::any_of(applyDeclaration.WriteComponentTypeIndices,
+                                                          [&waveWriteComponentTypeIndices](const std::type_index& typeIndex)
+                                                          {
+                                                              return std::ranges::find(waveWriteComponentTypeIndices, typeIndex)
+                                                                     != waveWriteComponentTypeIndices.end();
+                                                          });
+        if (isConflicting)
+        {
+            applyWaveBegins_.push_back(systemIndex);
+            waveWriteComponentTypeIndices.clear();
+        }
+
+        isWaveExclusive = !applyDeclaration.IsWriteSetDeclared;
+        waveWriteComponentTypeIndices.insert(waveWriteComponentTypeIndices.end(),
+                                             applyDeclaration.WriteComponentTypeIndices.begin(),
+                                             applyDeclaration.WriteComponentTypeIndices.end());
+    }
+    applyWaveBegins_.push_back(multiThreadedSystemApplyDeclarations_.size());
+}
+
+void F_SystemManager::WakeCalculateThreads()
+{
+    workDone_.store(false, std::memory_order_relaxed);
+    workingThreadCount_.store(ThreadCount, std::memory_order_relaxed);
+    for (auto& calculateThreadContext : calculateThreadContexts_)
+    {
+        calculateThreadContext.Working.store(true, std::memory_order_release);
+        calculateThreadContext.Working.notify_one();
+    }
+}
+
+void F_SystemManager::WaitCalculateThreads()
+{
+    while (!workDone_.load(std::memory_order_acquire))
+    {
+        workDone_.wait(false, std::memory_order_acquire);
+    }
+}
+
+void F_SystemManager::FinishCalculateThreadWork(CalculateThreadContext& calculateThreadContext)
+{
+    calculateThreadContext.Working.store(false, std::memory_order_release);
+    if (workingThreadCount_.fetch_add(-1, std::memory_order_acq_rel) == 1)
+    {
+        workDone_.store(true, std::memory_order_release);
+        workDone_.notify_one();
+    }
+}
+
+void F_SystemManager::RunApplyJobs(F_Pathfinder& pathfinder)
+{
+    for (auto applyJobIndex = applyJobCursor_.fetch_add(1, std::memory_order_relaxed);
+         static_cast<size_t>(applyJobIndex) < applyJobs_.size();
+         applyJobIndex = applyJobCursor_.fetch_add(1, std::memory_order_relaxed))
+    {
+        const auto& applyJob = applyJobs_[applyJobIndex];
+        if (applyJob.ThreadId != AllThreads)
+        {
+            ApplyRevisionData(applyJob.SystemIndex, GetRevisionDataFirstNode(applyJob.ThreadId, applyJob.SystemIndex), pathfinder);
+            continue;
+        }
+
+        // 아무 스레드도 기록하지 않았더라도 시스템마다 정확히 한 번 적용함.
+        ApplyRevisionData(applyJob.SystemIndex, JoinRevisionDataLists(applyJob.SystemIndex), pathfinder);
+    }
+}
+
+std::atomic<F_RevisionDataNode*>& F_SystemManager::JoinRevisionDataLists(const size_t systemIndex)
+{
+    // 뒤 스레드의 리스트부터 앞 스레드 리스트의 끝 노드 뒤에 이어, 스레드 순서대로인 하나의 리스트를 0번 스레드의 슬롯에 남김.
+    F_RevisionDataNode* joinedFirstNode = nullptr;
+    for (int threadId = ThreadCount; threadId >= 0; --threadId)
+    {
+        auto& revisionDataFirstNode = GetRevisionDataFirstNode(threadId, systemIndex);
+        const auto firstNode = revisionDataFirstNode.load(std::memory_order_relaxed);
+        if (firstNode == nullptr)
+        {
+            continue;
+        }
+
+        auto lastNode = firstNode;
+        while (lastNode->Next != nullptr)
+        {
+            lastNode = lastNode->Next;
+        }
+        lastNode->Next = joinedFirstNode;
+        joinedFirstNode = firstNode;
+        revisionDataFirstNode.store(nullptr, std::memory_order_relaxed);
+    }
+
+    auto& joinedRevisionDataFirstNode = GetRevisionDataFirstNode(0, systemIndex);
+    joinedRevisionDataFirstNode.store(joinedFirstNode, std::memory_order_relaxed);
+    return joinedRevisionDataFirstNode;
+}
+
+void F_SystemManager::ApplyRevisionData(const size_t systemIndex,
+                                        std::atomic<F_RevisionDataNode*>& revisionDataFirstNode,
+                                        F_Pathfinder& pathfinder)
+{
+    const auto& systemBlueprint = multiThreadedSystemBlueprints_[systemIndex].second;
+    systemBlueprint
+        .ApplyFunction(F_ApplyParams{ F_RevisionDataReadContext{ revisionDataFirstNode },
+                                      EntityManagerRef,
+                                      EventManagerRef,
+                                      pathfinder,
+                                      currentDeltaTime_,
+                                      currentDeltaTicks_,
+                                      currentTick_ });
+    systemBlueprint.ReleaseRevisionDataNodeFunction(revisionDataFirstNode);
+    revisionDataFirstNode = nullptr;
+}
@@ -9,11 +9,11 @@
 #include "F_MemoryPoolManager.h"
 #include "F_ComponentContainer.h"
 #include "F_Pathfinder.h"
-#include <unordered_map>
 #include <thread>
 #include <atomic>
-#include <shared_mutex>
+#include <tuple>
 #include <typeindex>
+#include <vector>
 
 class F_EntityManager;
 
@@ -75,7 +75,10 @@ public:
         }
 
         multiThreadedSystemBlueprints_.emplace_back(typeid(TMultiThreadSystem), TMultiThreadSystem::MultiThreadSystemBlueprint);
-        revisionDataFirstNodes_.emplace(typeid(TMultiThreadSystem), nullptr);
+        multiThreadedSystemApplyDeclarations_.push_back(MakeApplyDeclaration<TMultiThreadSystem>());
+        axisMemoryPools_.push_back(nullptr);
+        revisionDataHeads_ = std::vector<RevisionDataHead>((ThreadCount + 1) * multiThreadedSystemBlueprints_.size());
+        BuildApplyWaves();
     }
 
     void Update(double deltaTime, uint64_t deltaTicks, uint64_t currentTick);
@@ -83,26 +86,102 @@ public:
     void CalculateThreadBody(int threadId);
 
 private:
-    struct MultithreadWorkCursor
+    // 스레드마다, 시스템마다 따로 두는 Revision 리스트의 첫 노드. 각 스레드는 자기 슬롯에만 추가하므로 CAS가 경합하지 않으며,
+    // 슬롯마다 캐시 라인을 따로 두어 거짓 공유도 없음.
+    struct alignas(64) RevisionDataHead
     {
-        int SystemIndex;
-        const F_MemoryPool* EntityComponentMemoryPoolPtr;
-        std::atomic<int> EntityComponentMemoryBlockIndex;
+        std::atomic<F_RevisionDataNode*> FirstNode{ nullptr };
     };
 
+    // Apply 단계에서 시스템이 쓰는 컴포넌트에 대한 선언. 시스템 타입에 다음을 정의하여 선언함.
+    // using ApplyWriteComponents = std::tuple<C_A, C_B>; - Apply가 쓰는(그리고 다른 시스템이 쓸 수 있는 것 중 읽는) 컴포넌트들.
+    //     선언하지 않은 시스템은 모든 컴포넌트를 쓰는 것으로 보고 단독으로 Apply함.
+    // static constexpr bool IsApplyPartitionedByEntity = true; - Revision이 그것을 기록한 엔티티만 수정하는 경우.
+    //     각 엔티티는 한 스레드만 처리하므로, 스레드별 Revision 리스트들을 동시에 Apply할 수 있음. ApplyWriteComponents도 선언해야 함.
+    //     이 경우 Apply는 비어 있지 않은 스레드별 리스트마다 한 번씩(모두 비었으면 빈 리스트로 한 번) 호출되고 각 호출은 그 리스트만 보므로,
+    //     틱마다 한 번만 해야 하는 일은 Apply에 두지 말 것.
+    // IsApplyPartitionedByEntity가 아닌 시스템의 Apply는 틱마다 정확히 한 번, 모든 스레드의 Revision을 이은 하나의 리스트로 호출됨.
+    // 선언한 시스템의 Apply는 다른 시스템과 동시에 같은 F_EntityManager, F_EventManager를 사용하므로, 선언한 컴포넌트의 값만 수정하고
+    // 이벤트 발행이나 엔티티·컴포넌트의 추가/삭제는 하지 말 것. 두 매니저는 이를 검사하지 않으므로 선언이 이 약속을 지키는지는 시스템 작성자가 확인해야 함.
+    // 그런 일이 필요한 시스템은 선언하지 않으면 메인 스레드에서 단독으로 Apply됨.
+    struct ApplyDeclaration
+    {
+        std::vector<std::type_index> WriteComponentTypeIndices;
+        bool IsWriteSetDeclared;
+        bool IsPartitionedByEntity;
+    };
+
+    struct ApplyJob
+    {
+        size_t SystemIndex;
+        int ThreadId; // AllThreads이면 모든 스레드의 리스트를 이어 한 번에 Apply.
+    };
+
+    static constexpr int AllThreads = -1;
+
+    static constexpr uint32_t BlocksPerClaim = 32;
+
     F_EntityManager& EntityManagerRef;
     F_EventManager& EventManagerRef;
     std::vector<std::pair<std::type_index, const F_SingleThreadSystemBlueprint&>> singleThreadedSystemBlueprints_;
     std::vector<std::pair<std::type_index, const F_MultiThreadSystemBlueprint&>> multiThreadedSystemBlueprints_;
-    std::unordered_map<std::type_index, std::atomic<F_RevisionDataNode*>> revisionDataFirstNodes_;
+    std::vector<ApplyDeclaration> multiThreadedSystemApplyDeclarations_;
+    std::vector<RevisionDataHead> revisionDataHeads_; // [threadId * 시스템 수 + 시스템 Index]
+
+    // 쓰는 컴포넌트가 겹치지 않는 연속된 시스템들의 묶음. [applyWaveBegins_[i], applyWaveBegins_[i + 1])가 i번째 묶음.
+    std::vector<size_t> applyWaveBegins_;
+    std::vector<ApplyJob> applyJobs_;
+    std::atomic_int applyJobCursor_;
+    std::atomic_bool isApplyPhase_;
 
     std::vector<CalculateThreadContext> calculateThreadContexts_;
     std::atomic_int workingThreadCount_;
     std::atomic_bool workDone_;
     const int ThreadCount;
 
-    std::shared_mutex currentMultithreadWorkCursorMutex_;
-    MultithreadWorkCursor currentMultithreadWorkCursor_;
+    std::vector<const F_MemoryPool*> axisMemoryPools_; // 시스템별 축 컴포넌트의 메모리 풀. Update() 시작 시 갱신.
+    alignas(64) std::atomic_uint64_t multithreadWorkCursor_; // (시스템 Index << 32) | 블록 Index
+
+    std::atomic<F_RevisionDataNode*>& GetRevisionDataFirstNode(int threadId, size_t systemIndex);
+
+    template<IsMultiThreadSystem TMultiThreadSystem>
+    static ApplyDeclaration MakeApplyDeclaration()
+    {
+        ApplyDeclaration applyDeclaration{ {}, false, false };
+        if constexpr (requires { typename TMultiThreadSystem::ApplyWriteComponents; })
+        {
+            applyDeclaration.WriteComponentTypeIndices = MakeTypeIndices(
+                static_cast<typename TMultiThreadSystem::ApplyWriteComponents*>(nullptr));
+            applyDeclaration.IsWriteSetDeclared = true;
+        }
+        if constexpr (requires { TMultiThreadSystem::IsApplyPartitionedByEntity; })
+        {
+            static_assert(requires { typename TMultiThreadSystem::ApplyWriteComponents; },
+                          "IsApplyPartitionedByEntity requires ApplyWriteComponents.");
+            applyDeclaration.IsPartitionedByEntity = TMultiThreadSystem::IsApplyPartitionedByEntity;
+        }
+        return applyDeclaration;
+    }
+
+    template<typename... TComponents>
+    static std::vector<std::type_index> MakeTypeIndices(std::tuple<TComponents...>*)
+    {
+        return { std::type_index{ typeid(TComponents) }... };
+    }
+
+    void BuildApplyWaves();
+
+    void WakeCalculateThreads();
+
+    void WaitCalculateThreads();
+
+    void FinishCalculateThreadWork(CalculateThreadContext& calculateThreadContext);
+
+    void RunApplyJobs(F_Pathfinder& pathfinder);
+
+    std::atomic<F_RevisionDataNode*>& JoinRevisionDataLists(size_t systemIndex);
+
+    void ApplyRevisionData(size_t systemIndex, std::atomic<F_RevisionDataNode*>& revisionDataFirstNode, F_Pathfinder& pathfinder);
 
     double currentDeltaTime_;
     uint64_t currentDeltaTicks_;
@@ -5,124 +5,408 @@
 
 #include "G_Pathfinder.h"
 
+#include "F_ConnectivityIndex.h"
 #include "F_Executor.h"
 #include "F_Threads.h"
 #include "G_Map.h"
 
 #include <godot_cpp/variant/vector2i.hpp>
-#include <ranges>
+#include <algorithm>
+#include <limits>
 
 using namespace Core;
 using namespace M_Pathfind;
 using namespace godot;
 
 G_Pathfinder::G_Pathfinder()
-    : PerThreadContexts{ std::make_unique<PerThreadContext[]>(F_Threads::GetSingleton().GetThreadCount()) }
+    : PerThreadContexts{}
 {
 }
 
+G_Pathfinder::SearchStatistics G_Pathfinder::GetSearchStatistics() const
+{
+    SearchStatistics searchStatistics{};
+    const auto threadCount = PerThreadContexts.GetThreadCount();
+    for (size_t threadId = 0; threadId < threadCount; ++threadId)
+    {
+        const auto& threadStatistics = PerThreadContexts[threadId].Statistics;
+        searchStatistics.SearchCount += threadStatistics.SearchCount;
+        searchStatistics.FoundCount += threadStatistics.FoundCount;
+        searchStatistics.ExpansionCount += threadStatistics.ExpansionCount;
+        searchStatistics.PathStepCount += threadStatistics.PathStepCount;
+        searchStatistics.TotalNanoseconds += threadStatistics.TotalNanoseconds;
+        for (size_t bucket = 0; bucket < SearchStatistics::LatencyBucketCount; ++bucket)
+        {
+            searchStatistics.LatencyHistogram[bucket] += threadStatistics.LatencyHistogram[bucket];
+        }
+    }
+    return searchStatistics;
+}
+
+void G_Pathfinder::ResetSearchStatistics()
+{
+    const auto threadCount = PerThreadContexts.GetThreadCount();
+    for (size_t threadId = 0; threadId < threadCount; ++threadId)
+    {
+        PerThreadContexts[threadId].Statistics = SearchStatistics{};
+    }
+}
+
+uint64_t G_Pathfinder::SearchStatistics::GetLatencyPercentileNanoseconds(const double percentile) const
+{
+    if constexpr (!IsSearchTimingEnabled)
+    {
+        return 0;
+    }
+
+    const auto targetCount = static_cast<uint64_t>(static_cast<double>(SearchCount) * percentile);
+    uint64_t accumulatedCount = 0;
+    for (size_t bucket = 0; bucket < LatencyBucketCount; ++bucket)
+    {
+        accumulatedCount += LatencyHistogram[bucket];
+        if (accumulatedCount > targetCount)
+        {
+            return uint64_t{ 1 } << bucket;
+        }
+    }
+    return uint64_t{ 1 } << (LatencyBucketCount - 1);
+}
+
+void G_Pathfinder::RecordSearch(PerThreadContext& context,
+                                const std::chrono::steady_clock::time_point searchBeginTime,
+                                const bool searchFound,
+                                const uint64_t expansionCount)
+{
+    auto& statistics = context.Statistics;
+    statistics.SearchCount += 1;
+    statistics.ExpansionCount += expansionCount;
+    if constexpr (IsSearchTimingEnabled)
+    {
+        const auto elapsedNanoseconds = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - searchBeginTime).count());
+        statistics.TotalNanoseconds += elapsedNanoseconds;
+        statistics.LatencyHistogram[std::min<size_t>(std::bit_width(elapsedNanoseconds), SearchStatistics::LatencyBucketCount - 1)] += 1;
+    }
+    if (searchFound)
+    {
+        statistics.FoundCount += 1;
+        statistics.PathStepCount += context.AstarPathMakerStack.size();
+    }
+}
+
+void G_Pathfinder::WarmUp(const F_MutableContext& context, const Vector2i& mapSize)
+{
+    // ProcessPathRequests()용 SearchState는 어느 워커든 사용할 수 있지만, 노드 배열의 할당과 초기화는 스레드별로 나누어 맡김.
+    CreateResumableSearchStates();
+
+    WarmUpImpl(F_Threads::MainThreadId, mapSize);
+
+    struct Result
+    {
+    };
+    context.Executor.ParallelForWorkerThreads<Result>(
+        context,
+        [this, &mapSize](const F_ImmutableContext&) -> std::optional<Result>
+        {
+            WarmUpImpl(F_Threads::GetCurrentThreadIdUnchecked(), mapSize);
+            return std::nullopt;
+        });
+}
+
+void G_Pathfinder::WarmUpImpl(const uint32_t threadId, const Vector2i& mapSize)
+{
+    auto& threadContext = PerThreadContexts[threadId];
+    ResizeSearchState(threadContext.AstarSearch, mapSize);
+    if (!threadContext.AstarBidirectionalSearch)
+    {
+        threadContext.AstarBidirectionalSearch = std::make_unique<SearchState>();
+    }
+    ResizeSearchState(*threadContext.AstarBidirectionalSearch, mapSize);
+
+    // 8방향 이동이므로 일반적인 경로의 길이는 맵의 긴 변 정도임.
+    const auto typicalStepCount = static_cast<uint32_t>(std::max(mapSize.x, mapSize.y));
+    threadContext.AstarPathMakerStack.reserve(typicalStepCount);
+    threadContext.RepairPathSteps.reserve(typicalStepCount);
+    threadContext.CompletedPathSteps.reserve(typicalStepCount * ResumableSearchStatesPerThread);
+    threadContext.AstarPathStepSlab.Reserve(typicalStepCount * 64);
+    threadContext.AstarPathEntryPool.Reserve(WarmUpPathEntryCount);
+    threadContext.NewPathEntryIds.reserve(WarmUpPathEntryCount);
+
+    const auto cellCountX = static_cast<uint32_t>((mapSize.x + PathIndexCellSize - 1) / PathIndexCellSize);
+    const auto cellCountY = static_cast<uint32_t>((mapSize.y + PathIndexCellSize - 1) / PathIndexCellSize);
+    if (threadContext.PathIndexCellCountX != cellCountX || threadContext.PathIndexCells.size() != cellCountX * cellCountY)
+    {
+        threadContext.PathIndexCellCountX = cellCountX;
+        threadContext.PathIndexCells.clear();
+        threadContext.PathIndexCells.resize(cellCountX * cellCountY);
+    }
+    for (auto& cell : threadContext.PathIndexCells)
+    {
+        cell.reserve(PathIndexCellCompactSize);
+    }
+
+    for (uint32_t index = 0; index < ResumableSearchStatesPerThread; ++index)
+    {
+        ResizeSearchState(*resumableSearchStates_[threadId * ResumableSearchStatesPerThread + index], mapSize);
+    }
+}
+
+G_Pathfinder::MemoryUsage G_Pathfinder::GetMemoryUsage(const uint32_t threadId) const
+{
+    const auto& threadContext = PerThreadContexts[threadId];
+    MemoryUsage memoryUsage{};
+
+    memoryUsage.SearchBytes = GetSearchStateBytes(threadContext.AstarSearch)
+                              + threadContext.AstarPathMakerStack.capacity() * sizeof(PathStep)
+                              + threadContext.RepairPathSteps.capacity() * sizeof(PathStep);
+    if (threadContext.AstarBidirectionalSearch)
+    {
+        memoryUsage.SearchBytes += GetSearchStateBytes(*threadContext.AstarBidirectionalSearch);
+    }
+
+    if (!resumableSearchStates_.empty())
+    {
+        for (uint32_t index = 0; index < ResumableSearchStatesPerThread; ++index)
+        {
+            memoryUsage.ResumableSearchBytes +=
+                GetSearchStateBytes(*resumableSearchStates_[threadId * ResumableSearchStatesPerThread + index]);
+        }
+    }
+
+    memoryUsage.PathStepBytes = threadContext.AstarPathStepSlab.GetCapacityBytes();
+
+    memoryUsage.PathIndexBytes = threadContext.PathIndexCells.capacity() * sizeof(std::vector<uint32_t>)
+                                 + threadContext.RepairCandidatePathEntryIds.capacity() * sizeof(uint32_t);
+    for (const auto& cell : threadContext.PathIndexCells)
+    {
+        memoryUsage.PathIndexBytes += cell.capacity() * sizeof(uint32_t);
+    }
+
+    memoryUsage.RequestBytes = threadContext.PendingPathRequests.capacity() * sizeof(PathRequest)
+                               + threadContext.CompletedPathRequests.capacity() * sizeof(CompletedPathRequest)
+                               + threadContext.CompletedPathSteps.capacity() * sizeof(PathStep);
+    return memoryUsage;
+}
+
 PathHandle G_Pathfinder::Pathfind(const U_TiledDatas<uint32_t>& costDatas,
                                   const Vector2i& from,
                                   const Vector2i& to) const
 {
-    const auto threadId = F_Threads::GetSingleton().GetCurrentThreadId();
+    const auto threadId = F_Threads::GetCurrentThreadIdUnchecked();
     auto& context = PerThreadContexts[threadId];
-    context.AstarSearchVersion += 1;
+    const auto searchBeginTime = GetSearchBeginTime();
 
-    const auto mapSize = costDatas.GetSize();
-    if (context.AstarSearchNodes.GetSize() != mapSize)
+    const auto searchFound = SearchPath(context, costDatas, from, to);
+    RecordSearch(context, searchBeginTime, searchFound, context.AstarSearch.ExpansionCount);
+    return EmplacePathEntry(context, threadId, costDatas, searchFound, from, to);
+}
+
+/**
+ * 멈출 때 요청을 asyncPathRequests_에 올리고, ProcessPathRequests()가 요청을 끝내면 executor로 코루틴을 재개함.
+ */
+class G_Pathfinder::PathfindAwaiter final
+{
+public:
+    PathfindAwaiter(const G_Pathfinder& pathfinder,
+                    F_Executor& executor,
+                    const Vector2i& from,
+                    const Vector2i& to,
+                    const uint32_t priority)
+        : Pathfinder{ pathfinder },
+          Executor{ executor },
+          From{ from },
+          To{ to },
+          Priority{ priority },
+          ResultPathHandle{}
     {
-        context.AstarSearchNodes.Resize(mapSize, {});
     }
 
-    /// FROM, TO 범위 체크 ....
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
 
-    context.AstarSearchQueue.Reset();
-    context.AstarSearchNodes.GetDataAt(to) = AstarSearchNode
+    void await_suspend(const std::coroutine_handle<> handle)
     {
-        to,
-        to,
-        0,
-        GetH(from, to),
-        context.AstarSearchVersion
-    };
-    context.AstarSearchQueue.Push(&context.AstarSearchNodes.GetDataAt(to));
+        Continuation = handle;
+        // 잠금을 푼 직후 다른 스레드에서 재개될 수 있으므로, 추가한 뒤에는 this를 건드리지 않음.
+        std::lock_guard lock{ Pathfinder.asyncPathRequestsMutex_ };
+        Pathfinder.asyncPathRequests_.push_back(this);
+    }
+
+    M_Pathfind::PathHandle await_resume() const noexcept
+    {
+        return ResultPathHandle;
+    }
 
-    while (!context.AstarSearchQueue.IsEmpty()
-           && context.AstarSearchNodes.GetDataAt(from).Version != context.AstarSearchVersion)
+    const G_Pathfinder& Pathfinder;
+    F_Executor& Executor;
+    const Vector2i From;
+    const Vector2i To;
+    const uint32_t Priority;
+    std::coroutine_handle<> Continuation;
+    M_Pathfind::PathHandle ResultPathHandle; // ProcessPathRequests()가 대기열에 옮길 때 설정.
+};
+
+F_Task<PathHandle> G_Pathfinder::PathfindAsync(F_Executor& executor,
+                                               const Vector2i from,
+                                               const Vector2i to,
+                                               const uint32_t priority) const
+{
+    co_return co_await PathfindAwaiter{ *this, executor, from, to, priority };
+}
+
+PathHandle G_Pathfinder::PathfindToNearest(const U_TiledDatas<uint32_t>& costDatas,
+                                           const Vector2i& from,
+                                           const std::span<const Vector2i> targets) const
+{
+    const auto threadId = F_Threads::GetCurrentThreadIdUnchecked();
+    auto& context = PerThreadContexts[threadId];
+    const auto searchBeginTime = GetSearchBeginTime();
+
+    // 탐색이 원래 to에서 from 방향으로 진행되므로, 모든 target을 시작 노드로 넣기만 하면 가장 가까운 target에서 출발한 경로가 먼저 from에 도달함.
+    BeginSearch(context.AstarSearch, costDatas, from, targets);
+    if (ContinueSearch(context.AstarSearch, costDatas, std::numeric_limits<uint32_t>::max()) != E_SearchResult::Found)
     {
-        const auto currentNode = context.AstarSearchQueue.Pop();
+        RecordSearch(context, searchBeginTime, false, context.AstarSearch.ExpansionCount);
+        return EmplacePathEntry(context, threadId, costDatas, false, from, targets.empty() ? from : targets.front());
+    }
+
+    MakePath(context.AstarSearch, context.AstarPathMakerStack);
+    RecordSearch(context, searchBeginTime, true, context.AstarSearch.ExpansionCount);
+    const auto& reachedStep = context.AstarPathMakerStack.back();
+    return EmplacePathEntry(context, threadId, costDatas, true, from, Vector2i{ reachedStep.X, reachedStep.Y });
+}
 
-        for (const auto [offsetX, offsetY] : DirectionOffsets)
+PathHandle G_Pathfinder::PathfindBidirectional(const U_TiledDatas<uint32_t>& costDatas,
+                                               const Vector2i& from,
+                                               const Vector2i& to) const
+{
+    const auto threadId = F_Threads::GetCurrentThreadIdUnchecked();
+    auto& context = PerThreadContexts[threadId];
+    const auto searchBeginTime = GetSearchBeginTime();
+    if (!context.AstarBidirectionalSearch)
+    {
+        context.AstarBidirectionalSearch = std::make_unique<SearchState>();
+    }
+
+    // toSearch는 to에서 from으로(기존 탐색과 동일), fromSearch는 from에서 to로 진행. 한쪽이 꺼낸 노드를 다른 쪽이 이미 방문했다면 두 탐색이 만난 것.
+    auto& toSearch = context.AstarSearch;
+    auto& fromSearch = *context.AstarBidirectionalSearch;
+    BeginSearch(toSearch, costDatas, from, to);
+    BeginSearch(fromSearch, costDatas, to, from);
+
+    auto meetTileIndex = std::numeric_limits<uint32_t>::max();
+    while (!toSearch.Queue.IsEmpty() && !fromSearch.Queue.IsEmpty())
+    {
+        const auto toTileIndex = toSearch.Queue.Pop();
+        if (fromSearch.Nodes[toTileIndex].Version == fromSearch.Version)
         {
-            const auto nearPosition = currentNode->CurrentPosition + Vector2i{ offsetX, offsetY };
+            meetTileIndex = toTileIndex;
+            break;
+        }
+        ExpandNode(toSearch, costDatas, toTileIndex);
 
-            if (!IsValidPosition(mapSize, nearPosition)
-                || context.AstarSearchNodes.GetDataAt(nearPosition).Version == context.AstarSearchVersion)
-            {
-                continue;
-            }
-            //
-            // TODO 현재 벽, 지형지물 등 bool 기반의 장애물 체계에서 비용 기반 체계 변경 중
-            // TODO 비용 검사하는 코드 여기 삽입할 것
-            //
-            auto& nearSearchNode = context.AstarSearchNodes.GetDataAt(nearPosition);
-            nearSearchNode.Version = context.AstarSearchVersion;
-            nearSearchNode.NextPosition = currentNode->CurrentPosition;
-            nearSearchNode.CurrentPosition = nearPosition;
-            nearSearchNode.G = currentNode->G + (offsetX != 0 && offsetY != 0 ? 14 : 10);
-            nearSearchNode.H = GetH(from, nearPosition);
-            context.AstarSearchQueue.Push(&nearSearchNode);
+        const auto fromTileIndex = fromSearch.Queue.Pop();
+        if (toSearch.Nodes[fromTileIndex].Version == toSearch.Version)
+        {
+            meetTileIndex = fromTileIndex;
+            break;
         }
+        ExpandNode(fromSearch, costDatas, fromTileIndex);
     }
 
-    const auto& fromSearchNode = context.AstarSearchNodes.GetDataAt(from);
-    if (fromSearchNode.Version != context.AstarSearchVersion)
+    if (meetTileIndex == std::numeric_limits<uint32_t>::max())
+    {
+        RecordSearch(context, searchBeginTime, false, toSearch.ExpansionCount + fromSearch.ExpansionCount);
+        return EmplacePathEntry(context, threadId, costDatas, false, from, to);
+    }
+
+    // fromSearch의 부모 사슬은 만난 지점 -> from 순이므로 뒤집고, 만난 지점부터 toSearch의 부모 사슬(만난 지점 -> to)을 이어 붙임.
+    const auto meetPosition = Vector2i{ static_cast<int32_t>(meetTileIndex % toSearch.MapSize.x),
+                                        static_cast<int32_t>(meetTileIndex / toSearch.MapSize.x) };
+    auto& pathMakerStack = context.AstarPathMakerStack;
+    pathMakerStack.clear();
+    AppendParentChain(fromSearch, meetPosition, pathMakerStack);
+    std::ranges::reverse(pathMakerStack);
+    pathMakerStack.pop_back();
+    AppendParentChain(toSearch, meetPosition, pathMakerStack);
+    RecordSearch(context, searchBeginTime, true, toSearch.ExpansionCount + fromSearch.ExpansionCount);
+    return EmplacePathEntry(context, threadId, costDatas, true, from, to);
+}
+
+PathHandle G_Pathfinder::EmplacePathEntry(PerThreadContext& context,
+                                          const uint32_t threadId,
+                                          const U_TiledDatas<uint32_t>& costDatas,
+                                          const bool searchFound,
+                                          const Vector2i& from,
+                                          const Vector2i& to)
+{
+    if (!searchFound)
     {
         const auto [pathEntryId, pathEntry] = context.AstarPathEntryPool.Emplace(
             uint64_t{ 0 },
-            nullptr,
-            nullptr,
+            uint32_t{ 0 },
+            uint32_t{ 0 },
+            uint32_t{ 0 },
+            false,
             from,
             to);
+        context.NewPathEntryIds.push_back(pathEntryId);
         return PathHandle{ threadId, pathEntryId };
     }
 
-    context.AstarPathMakerStack.clear();
-    for (auto currentNode = &context.AstarSearchNodes.GetDataAt(from);
-         ;
-         currentNode = &context.AstarSearchNodes.GetDataAt(currentNode->NextPosition))
-    {
-        context.AstarPathMakerStack.push_back(currentNode);
-        if (currentNode->CurrentPosition == to)
-        {
-            break;
-        }
-    }
+    const auto stepCount = static_cast<uint32_t>(context.AstarPathMakerStack.size());
+    const auto stepOffset = context.AstarPathStepSlab.Acquire(stepCount);
+    WritePathSteps(context, context.AstarPathStepSlab.GetSteps(stepOffset));
 
-    const auto headNode = [this, &context]
-    {
-        PathNode* nextNode = nullptr;
-        for (const auto node : std::views::reverse(context.AstarPathMakerStack))
-        {
-            const auto currentPathNode = context.AstarPathNodePool.Acquire();
-            *currentPathNode = PathNode
-            {
-                static_cast<uint16_t>(node->CurrentPosition.x),
-                static_cast<uint16_t>(node->CurrentPosition.y),
-                nextNode
-            };
-            nextNode = currentPathNode;
-        }
-        return nextNode;
-    }();
+    const auto [pathEntryId, pathEntry] = context.AstarPathEntryPool.Emplace(
+        uint64_t{ 0 },
+        stepOffset,
+        stepCount,
+        uint32_t{ 0 },
+        false,
+        from,
+        to);
+    IndexPath(context, pathEntryId, *pathEntry, costDatas.GetSize());
+    context.NewPathEntryIds.push_back(pathEntryId);
+    return PathHandle{ threadId, pathEntryId };
+}
+
+PathHandle G_Pathfinder::RequestPathfind(const Vector2i& from, const Vector2i& to, const uint32_t priority) const
+{
+    return EmplacePendingPathRequest(F_Threads::GetCurrentThreadIdUnchecked(), from, to, priority, nullptr);
+}
+
+PathHandle G_Pathfinder::EmplacePendingPathRequest(const uint32_t threadId,
+                                                   const Vector2i& from,
+                                                   const Vector2i& to,
+                                                   const uint32_t priority,
+                                                   PathfindAwaiter* const awaiter) const
+{
+    auto& context = PerThreadContexts[threadId];
 
     const auto [pathEntryId, pathEntry] = context.AstarPathEntryPool.Emplace(
         uint64_t{ 0 },
-        headNode,
-        headNode,
+        uint32_t{ 0 },
+        uint32_t{ 0 },
+        uint32_t{ 0 },
+        true,
         from,
         to);
+    context.NewPathEntryIds.push_back(pathEntryId);
+    context.PendingPathRequests.push_back(PathRequest
+        {
+            threadId,
+            pathEntryId,
+            priority,
+            NullSearchStateIndex,
+            false,
+            false,
+            from,
+            to,
+            awaiter
+        });
     return PathHandle{ threadId, pathEntryId };
 }
 
@@ -136,41 +420,701 @@ bool G_Pathfinder::CanReach(const U_TiledDatas<uint32_t>& floodFill, const Vecto
            *fromTileData == *toTileData;
 }
 
+bool G_Pathfinder::CanReach(const F_ConnectivityIndex& connectivityIndex, const Vector2i& from, const Vector2i& to) const
+{
+    return connectivityIndex.IsConnected(from, to);
+}
+
 
 void G_Pathfinder::Process(const F_MutableContext& context)
 {
-    ProcessImpl(F_Threads::MainThreadId, static_cast<F_ImmutableContext>(context));
+    // 스레드 컨텍스트 하나를 블록 하나로 하여, 메인 스레드와 워커들이 함께 컨텍스트를 하나씩 가져가 처리.
+    const auto immutableContext = static_cast<F_ImmutableContext>(context);
+    context.Executor.ForEachBlock(context,
+                                  PerThreadContexts.GetThreadCount(),
+                                  [this, &immutableContext](const size_t threadId)
+                                  {
+                                      ProcessImpl(static_cast<uint32_t>(threadId), immutableContext);
+                                  });
+}
+
+void G_Pathfinder::ProcessImpl(const uint32_t threadId, const F_ImmutableContext& context)
+{
+    auto& threadContext = PerThreadContexts[threadId];
+    const auto currentWorldTick = context.WorldCurrentTick;
+    const auto schedule = [&threadContext](const uint32_t pathEntryId, const uint64_t expiryWorldTick)
+    {
+        threadContext.ExpiryWheel[expiryWorldTick % ExpiryWheelSize].push_back(pathEntryId);
+    };
+
+    for (const auto pathEntryId : threadContext.NewPathEntryIds)
+    {
+        const auto pathEntry = threadContext.AstarPathEntryPool.Get(pathEntryId);
+        if (pathEntry->ExpiryWorldTick == 0)
+        {
+            pathEntry->ExpiryWorldTick = currentWorldTick + 2 * PathEntryRefreshIntervalWorldTick;
+        }
+        schedule(pathEntryId, pathEntry->ExpiryWorldTick);
+    }
+    threadContext.NewPathEntryIds.clear();
+
+    // ExpiryWorldTick < currentWorldTick 이면 만료이므로, 지난 호출 이후 currentWorldTick - 1까지의 칸만 방문함.
+    // 그 사이 GetPathEntry()로 갱신된 엔트리는 만료시키지 않고 갱신된 틱의 칸으로 옮김.
+    const auto lastExpiringWorldTick = std::max<uint64_t>(currentWorldTick, 1) - 1;
+    if (!threadContext.ExpiredWorldTick)
+    {
+        threadContext.ExpiredWorldTick = lastExpiringWorldTick;
+    }
+
+    const auto firstWorldTick = std::max(*threadContext.ExpiredWorldTick + 1,
+                                         currentWorldTick > ExpiryWheelSize ? currentWorldTick - ExpiryWheelSize : 0);
+    for (auto worldTick = firstWorldTick; worldTick < currentWorldTick; ++worldTick)
+    {
+        auto& expiringPathEntryIds = threadContext.ExpiringPathEntryIds;
+        expiringPathEntryIds.clear();
+        std::swap(expiringPathEntryIds, threadContext.ExpiryWheel[worldTick % ExpiryWheelSize]);
+
+        for (const auto pathEntryId : expiringPathEntryIds)
+        {
+            const auto pathEntry = threadContext.AstarPathEntryPool.Get(pathEntryId);
+            if (pathEntry->IsPending)
+            {
+                pathEntry->ExpiryWorldTick = currentWorldTick + 2 * PathEntryRefreshIntervalWorldTick;
+                schedule(pathEntryId, pathEntry->ExpiryWorldTick);
+                continue;
+            }
+
+            if (pathEntry->ExpiryWorldTick >= currentWorldTick)
+            {
+                schedule(pathEntryId, pathEntry->ExpiryWorldTick);
+                continue;
+            }
+
+            if (pathEntry->StepCount > 0)
+            {
+                threadContext.AstarPathStepSlab.Release(pathEntry->StepOffset, pathEntry->StepCount);
+            }
+            threadContext.AstarPathEntryPool.EraseBySparseIndex(pathEntryId);
+        }
+    }
+    threadContext.ExpiredWorldTick = std::max(*threadContext.ExpiredWorldTick, lastExpiringWorldTick);
+}
+
+void G_Pathfinder::ProcessPathRequests(const F_MutableContext& context,
+                                       const U_TiledDatas<uint32_t>& costDatas,
+                                       const std::chrono::microseconds timeBudget,
+                                       const uint32_t expansionBudgetPerRequest)
+{
+    // PathfindAsync()의 요청은 RequestPathfind()를 메인 스레드에서 호출한 것처럼 메인 스레드의 저장소에 엔트리를 만듦.
+    {
+        std::lock_guard lock{ asyncPathRequestsMutex_ };
+        for (const auto awaiter : asyncPathRequests_)
+        {
+            awaiter->ResultPathHandle = EmplacePendingPathRequest(F_Threads::MainThreadId,
+                                                            awaiter->From,
+                                                            awaiter->To,
+                                                            awaiter->Priority,
+                                                            awaiter);
+        }
+        asyncPathRequests_.clear();
+    }
+
+    const auto threadCount = PerThreadContexts.GetThreadCount();
+    for (size_t threadId = 0; threadId < threadCount; ++threadId)
+    {
+        auto& pendingPathRequests = PerThreadContexts[threadId].PendingPathRequests;
+        pathRequestQueue_.insert(pathRequestQueue_.end(), pendingPathRequests.begin(), pendingPathRequests.end());
+        pendingPathRequests.clear();
+    }
+
+    if (pathRequestQueue_.empty())
+    {
+        return;
+    }
+
+    CreateResumableSearchStates();
+
+    // 같은 우선순위 내에서는 먼저 들어온 요청(이전 틱에서 처리되지 못한 요청 포함)이 먼저 처리되도록 stable sort.
+    std::ranges::stable_sort(pathRequestQueue_,
+                             [](const PathRequest& lhs, const PathRequest& rhs)
+                             {
+                                 return lhs.Priority > rhs.Priority;
+                             });
+
+    // 진행 중인 탐색은 자신의 SearchState를 계속 보유하며, 새 요청은 남는 SearchState가 있을 때 탐색을 시작함.
+    // 남는 것이 없으면 우선순위가 더 낮은 진행 중 탐색 중 가장 낮은 것의 SearchState를 빼앗음. 빼앗긴 요청은 대기열에 남아
+    // SearchState가 생기면 처음부터 다시 탐색함. 우선순위 내림차순이므로 빼앗을 후보는 뒤에서부터 찾으며, 뒤의 요청일수록
+    // 우선순위가 낮아 후보가 줄어들기만 하므로 evictionCursor는 한 방향으로만 움직임.
+    activePathRequestIndices_.clear();
+    auto evictionCursor = static_cast<uint32_t>(pathRequestQueue_.size());
+    for (uint32_t requestIndex = 0; requestIndex < pathRequestQueue_.size(); ++requestIndex)
+    {
+        auto& request = pathRequestQueue_[requestIndex];
+        if (request.SearchStateIndex == NullSearchStateIndex)
+        {
+            if (freeResumableSearchStateIndices_.empty())
+            {
+                while (evictionCursor > requestIndex + 1
+                       && pathRequestQueue_[evictionCursor - 1].SearchStateIndex == NullSearchStateIndex)
+                {
+                    evictionCursor -= 1;
+                }
+                if (evictionCursor <= requestIndex + 1
+                    || pathRequestQueue_[evictionCursor - 1].Priority >= request.Priority)
+                {
+                    continue;
+                }
+
+                evictionCursor -= 1;
+                auto& evictedRequest = pathRequestQueue_[evictionCursor];
+                freeResumableSearchStateIndices_.push_back(evictedRequest.SearchStateIndex);
+                evictedRequest.SearchStateIndex = NullSearchStateIndex;
+            }
+
+            request.SearchStateIndex = freeResumableSearchStateIndices_.back();
+            request.IsCostChanged = false;
+            freeResumableSearchStateIndices_.pop_back();
+            BeginSearch(*resumableSearchStates_[request.SearchStateIndex], costDatas, request.From, request.To);
+        }
+        activePathRequestIndices_.push_back(requestIndex);
+    }
+
+    // SearchState를 받지 못한 요청들. 이번 호출에서 탐색을 끝낸 스레드가 그 SearchState로 우선순위 순서대로 이어서 처리함.
+    waitingPathRequestIndices_.clear();
+    for (uint32_t requestIndex = 0; requestIndex < pathRequestQueue_.size(); ++requestIndex)
+    {
+        if (pathRequestQueue_[requestIndex].SearchStateIndex == NullSearchStateIndex)
+        {
+            waitingPathRequestIndices_.push_back(requestIndex);
+        }
+    }
+
+    for (size_t threadId = 0; threadId < threadCount; ++threadId)
+    {
+        PerThreadContexts[threadId].CompletedPathRequests.clear();
+        PerThreadContexts[threadId].CompletedPathSteps.clear();
+    }
+
+    // 요청 하나를 블록 하나로 하여 메인 스레드와 워커들이 함께 가져가 처리함. 워커가 없으면 메인 스레드가 모두 처리함.
+    // 탐색을 끝낸 스레드는 그 SearchState로 대기 중인 다음 요청을 바로 시작하므로, 한 번의 호출에서 끝내는 요청 수는
+    // SearchState 수가 아니라 timeBudget으로 제한됨. timeBudget이 지난 뒤에는 새 탐색을 시작하지 않음.
+    const auto deadline = std::chrono::steady_clock::now() + timeBudget;
+    std::atomic<size_t> waitingCursor{ 0 };
+    context.Executor.ForEachBlock(
+        context,
+        activePathRequestIndices_.size(),
+        [this, &costDatas, &waitingCursor, deadline, expansionBudgetPerRequest](const size_t activeIndex)
+        {
+            auto& threadContext = PerThreadContexts.Local();
+            auto requestIndex = activePathRequestIndices_[activeIndex];
+            while (std::chrono::steady_clock::now() < deadline)
+            {
+                auto& request = pathRequestQueue_[requestIndex];
+                auto& searchState = *resumableSearchStates_[request.SearchStateIndex];
+                const auto searchBeginTime = GetSearchBeginTime();
+                const auto searchResult = ContinueSearch(searchState, costDatas, expansionBudgetPerRequest);
+                if (searchResult == E_SearchResult::Suspended)
+                {
+                    return;
+                }
+
+                const auto stepBegin = static_cast<uint32_t>(threadContext.CompletedPathSteps.size());
+                uint32_t stepCount = 0;
+                if (searchResult == E_SearchResult::Found)
+                {
+                    MakePath(searchState, threadContext.AstarPathMakerStack);
+                    stepCount = static_cast<uint32_t>(threadContext.AstarPathMakerStack.size());
+                    threadContext.CompletedPathSteps.resize(stepBegin + stepCount);
+                    WritePathSteps(threadContext, threadContext.CompletedPathSteps.data() + stepBegin);
+                }
+                // 여러 호출에 걸쳐 진행된 탐색이라도 마지막 호출에서의 시간만 지연 시간으로 기록됨.
+                RecordSearch(threadContext, searchBeginTime, searchResult == E_SearchResult::Found, searchState.ExpansionCount);
+                threadContext.CompletedPathRequests.push_back(
+                    CompletedPathRequest{ requestIndex, request.OwnerThreadId, request.PathEntryId, stepBegin, stepCount });
+
+                if (std::chrono::steady_clock::now() >= deadline)
+                {
+                    return;
+                }
+                const auto waitingIndex = waitingCursor.fetch_add(1, std::memory_order_relaxed);
+                if (waitingIndex >= waitingPathRequestIndices_.size())
+                {
+                    return;
+                }
+
+                // 끝낸 요청의 SearchState를 넘겨받은 요청은 이 스레드만 다루므로 잠금 없이 갱신함.
+                requestIndex = waitingPathRequestIndices_[waitingIndex];
+                auto& nextRequest = pathRequestQueue_[requestIndex];
+                nextRequest.SearchStateIndex = request.SearchStateIndex;
+                nextRequest.IsCostChanged = false;
+                request.SearchStateIndex = NullSearchStateIndex;
+                BeginSearch(searchState, costDatas, nextRequest.From, nextRequest.To);
+            }
+        });
+
+    // 탐색 결과는 처리한 스레드의 임시 버퍼에 있으므로, 요청한 스레드의 Slab으로 옮기는 작업은 메인 스레드에서 일괄 수행.
+    for (size_t threadId = 0; threadId < threadCount; ++threadId)
+    {
+        const auto& workerContext = PerThreadContexts[threadId];
+        for (const auto& completedPathRequest : workerContext.CompletedPathRequests)
+        {
+            // 다음 요청에 넘겨준 SearchState는 이미 NullSearchStateIndex로 바뀌어 있음.
+            auto& request = pathRequestQueue_[completedPathRequest.RequestIndex];
+            if (request.SearchStateIndex != NullSearchStateIndex)
+            {
+                freeResumableSearchStateIndices_.push_back(request.SearchStateIndex);
+            }
+
+            // 탐색 도중 막힌 타일은 이미 확장된 노드에 반영되지 않았으므로, 경로가 그런 타일을 지나면 처음부터 다시 탐색함.
+            const auto completedSteps = workerContext.CompletedPathSteps.data() + completedPathRequest.StepBegin;
+            if (request.IsCostChanged
+                && std::any_of(completedSteps,
+                               completedSteps + completedPathRequest.StepCount,
+                               [&costDatas](const PathStep& step)
+                               {
+                                   return costDatas.GetDataAt(Vector2i{ step.X, step.Y }) == ImpassableCost;
+                               }))
+            {
+                request.SearchStateIndex = NullSearchStateIndex;
+                continue;
+            }
+            request.IsCompleted = true;
+
+            auto& ownerContext = PerThreadContexts[completedPathRequest.OwnerThreadId];
+            const auto pathEntry = ownerContext.AstarPathEntryPool.Get(completedPathRequest.PathEntryId);
+            pathEntry->IsPending = false;
+            if (completedPathRequest.StepCount == 0)
+            {
+                continue;
+            }
+
+            pathEntry->StepOffset = ownerContext.AstarPathStepSlab.Acquire(completedPathRequest.StepCount);
+            pathEntry->StepCount = completedPathRequest.StepCount;
+            std::copy_n(completedSteps,
+                        completedPathRequest.StepCount,
+                        ownerContext.AstarPathStepSlab.GetSteps(pathEntry->StepOffset));
+            IndexPath(ownerContext, completedPathRequest.PathEntryId, *pathEntry, costDatas.GetSize());
+        }
+        PerThreadContexts[threadId].CompletedPathRequests.clear();
+    }
+
+    // 결과가 저장소에 모두 반영되고 대기열을 정리한 뒤에 PathfindAsync()의 코루틴들을 재개함. 워커가 없으면 Schedule()에서
+    // 바로 재개되어 코루틴이 새 요청을 올릴 수 있으므로, 대기열을 다 다룬 뒤에 호출함. 재개되면 Awaiter가 사라질 수 있으므로 미리 꺼내 둠.
+    std::vector<std::pair<F_Executor*, std::coroutine_handle<>>> continuations;
+    for (const auto& request : pathRequestQueue_)
+    {
+        if (request.IsCompleted && request.Awaiter)
+        {
+            continuations.emplace_back(&request.Awaiter->Executor, request.Awaiter->Continuation);
+        }
+    }
+
+    std::erase_if(pathRequestQueue_,
+                  [](const PathRequest& request)
+                  {
+                      return request.IsCompleted;
+                  });
+
+    for (const auto& [executor, continuation] : continuations)
+    {
+        executor->Schedule(continuation);
+    }
+}
+
+void G_Pathfinder::CreateResumableSearchStates()
+{
+    if (!resumableSearchStates_.empty())
+    {
+        return;
+    }
+
+    const auto searchStateCount = PerThreadContexts.GetThreadCount() * ResumableSearchStatesPerThread;
+    for (uint32_t searchStateIndex = 0; searchStateIndex < searchStateCount; ++searchStateIndex)
+    {
+        resumableSearchStates_.push_back(std::make_unique<SearchState>());
+        freeResumableSearchStateIndices_.push_back(searchStateIndex);
+    }
+}
+
+void G_Pathfinder::RepairPaths(const F_MutableContext& context, const U_TiledDatas<uint32_t>& costDatas)
+{
+    if (dirtyRects_.empty())
+    {
+        return;
+    }
+
+    // 진행 중인 탐색은 바뀐 비용을 일부만 반영하므로, 완료될 때 경로를 다시 검사하도록 표시함.
+    for (auto& request : pathRequestQueue_)
+    {
+        if (request.SearchStateIndex != NullSearchStateIndex)
+        {
+            request.IsCostChanged = true;
+        }
+    }
+
+    RepairPathsImpl(F_Threads::MainThreadId, costDatas);
 
     struct Result
     {
     };
     context.Executor.ParallelForWorkerThreads<Result>(
         context,
-        [this](const F_ImmutableContext& immutableContext) -> std::optional<Result>
+        [this, &costDatas](const F_ImmutableContext&) -> std::optional<Result>
         {
-            ProcessImpl(F_Threads::GetSingleton().GetCurrentThreadId(), immutableContext);
+            RepairPathsImpl(F_Threads::GetCurrentThreadIdUnchecked(), costDatas);
             return std::nullopt;
         });
+
+    dirtyRects_.clear();
 }
 
-void G_Pathfinder::ProcessImpl(const uint32_t threadId, const F_ImmutableContext& context)
+void G_Pathfinder::RepairPathsImpl(const uint32_t threadId, const U_TiledDatas<uint32_t>& costDatas) const
 {
     auto& threadContext = PerThreadContexts[threadId];
-    for (const auto [pathEntryId, pathEntry] : threadContext.AstarPathEntryPool)
+    if (threadContext.PathIndexCells.empty())
+    {
+        return;
+    }
+
+    const auto mapSize = costDatas.GetSize();
+    auto& candidatePathEntryIds = threadContext.RepairCandidatePathEntryIds;
+    candidatePathEntryIds.clear();
+    for (const auto& dirtyRect : dirtyRects_)
+    {
+        const auto dirtyEnd = dirtyRect.get_end();
+        const auto beginCellX = std::max(dirtyRect.position.x, 0) / PathIndexCellSize;
+        const auto beginCellY = std::max(dirtyRect.position.y, 0) / PathIndexCellSize;
+        const auto dirtyEndX = std::min(dirtyEnd.x, mapSize.x);
+        const auto dirtyEndY = std::min(dirtyEnd.y, mapSize.y);
+        for (int32_t cellY = beginCellY; cellY * PathIndexCellSize < dirtyEndY; ++cellY)
+        {
+            for (int32_t cellX = beginCellX; cellX * PathIndexCellSize < dirtyEndX; ++cellX)
+            {
+                const auto& cell = threadContext.PathIndexCells[cellY * threadContext.PathIndexCellCountX + cellX];
+                candidatePathEntryIds.insert(candidatePathEntryIds.end(), cell.begin(), cell.end());
+            }
+        }
+    }
+
+    std::ranges::sort(candidatePathEntryIds);
+    const auto [uniqueEnd, end] = std::ranges::unique(candidatePathEntryIds);
+    candidatePathEntryIds.erase(uniqueEnd, end);
+
+    for (const auto pathEntryId : candidatePathEntryIds)
     {
-        if (pathEntry.ExpiryWorldTick == 0)
+        const auto pathEntry = threadContext.AstarPathEntryPool.Get(pathEntryId);
+        if (!pathEntry || pathEntry->IsPending || pathEntry->StepCount == 0)
+        {
+            continue;
+        }
+
+        if (RepairPath(threadContext, *pathEntry, costDatas))
         {
-            pathEntry.ExpiryWorldTick = context.WorldCurrentTick + 2 * PathEntryRefreshIntervalWorldTick;
+            IndexPath(threadContext, pathEntryId, *pathEntry, mapSize);
         }
-        else if (pathEntry.ExpiryWorldTick < context.WorldCurrentTick)
+    }
+}
+
+bool G_Pathfinder::RepairPath(PerThreadContext& context,
+                              PathEntry& pathEntry,
+                              const U_TiledDatas<uint32_t>& costDatas) const
+{
+    const auto isBlockedDirtyStep = [this, &costDatas](const PathStep& step)
+    {
+        const auto position = Vector2i{ step.X, step.Y };
+        return costDatas.GetDataAt(position) == ImpassableCost
+               && std::ranges::any_of(dirtyRects_,
+                                      [&position](const Rect2i& dirtyRect)
+                                      {
+                                          return dirtyRect.has_point(position);
+                                      });
+    };
+
+    const auto steps = context.AstarPathStepSlab.GetSteps(pathEntry.StepOffset);
+    auto firstBlockedStepIndex = pathEntry.StepCount;
+    auto lastBlockedStepIndex = pathEntry.StepCount;
+    for (auto stepIndex = pathEntry.Cursor; stepIndex < pathEntry.StepCount; ++stepIndex)
+    {
+        if (isBlockedDirtyStep(steps[stepIndex]))
         {
-            for (PathNode* currentNode = pathEntry.Head,* nextNode = nullptr; currentNode; currentNode = nextNode)
+            firstBlockedStepIndex = std::min(firstBlockedStepIndex, stepIndex);
+            lastBlockedStepIndex = stepIndex;
+        }
+    }
+
+    if (firstBlockedStepIndex == pathEntry.StepCount)
+    {
+        return false;
+    }
+
+    // 막힌 구간의 바로 앞 Step과 바로 뒤 Step 사이만 다시 탐색함. 출발점이나 도착점 자체가 막혔거나, 우회로가 없어 탐색이
+    // 맵 전체로 퍼지기 전에 확장 수 제한에 걸리면 경로 없음으로 처리.
+    const bool canSplice = firstBlockedStepIndex > 0 && lastBlockedStepIndex + 1 < pathEntry.StepCount;
+    const auto segmentBeginStep = canSplice ? steps[firstBlockedStepIndex - 1] : PathStep{};
+    const auto segmentEndStep = canSplice ? steps[lastBlockedStepIndex + 1] : PathStep{};
+    if (!canSplice || !SearchPath(context,
+                                  costDatas,
+                                  Vector2i{ segmentBeginStep.X, segmentBeginStep.Y },
+                                  Vector2i{ segmentEndStep.X, segmentEndStep.Y },
+                                  MaxRepairExpansionCount))
+    {
+        context.AstarPathStepSlab.Release(pathEntry.StepOffset, pathEntry.StepCount);
+        pathEntry.StepOffset = 0;
+        pathEntry.StepCount = 0;
+        pathEntry.Cursor = 0;
+        return false;
+    }
+
+    // [0, firstBlocked - 1) + 새 구간(firstBlocked - 1 ~ lastBlocked + 1) + (lastBlocked + 1, StepCount)
+    const auto prefixStepCount = firstBlockedStepIndex - 1;
+    const auto segmentStepCount = static_cast<uint32_t>(context.AstarPathMakerStack.size());
+    const auto suffixStepCount = pathEntry.StepCount - lastBlockedStepIndex - 2;
+    auto& repairPathSteps = context.RepairPathSteps;
+    repairPathSteps.resize(prefixStepCount + segmentStepCount + suffixStepCount);
+    std::copy_n(steps, prefixStepCount, repairPathSteps.data());
+    WritePathSteps(context, repairPathSteps.data() + prefixStepCount);
+    std::copy_n(steps + lastBlockedStepIndex + 2, suffixStepCount, repairPathSteps.data() + prefixStepCount + segmentStepCount);
+
+    context.AstarPathStepSlab.Release(pathEntry.StepOffset, pathEntry.StepCount);
+    pathEntry.StepCount = static_cast<uint32_t>(repairPathSteps.size());
+    pathEntry.StepOffset = context.AstarPathStepSlab.Acquire(pathEntry.StepCount);
+    std::ranges::copy(repairPathSteps, context.AstarPathStepSlab.GetSteps(pathEntry.StepOffset));
+    return true;
+}
+
+void G_Pathfinder::IndexPath(PerThreadContext& context,
+                             const uint32_t pathEntryId,
+                             const PathEntry& pathEntry,
+                             const Vector2i& mapSize)
+{
+    const auto cellCountX = static_cast<uint32_t>((mapSize.x + PathIndexCellSize - 1) / PathIndexCellSize);
+    const auto cellCountY = static_cast<uint32_t>((mapSize.y + PathIndexCellSize - 1) / PathIndexCellSize);
+    if (context.PathIndexCellCountX != cellCountX || context.PathIndexCells.size() != cellCountX * cellCountY)
+    {
+        context.PathIndexCellCountX = cellCountX;
+        context.PathIndexCells.clear();
+        context.PathIndexCells.resize(cellCountX * cellCountY);
+    }
+
+    const auto steps = context.AstarPathStepSlab.GetSteps(pathEntry.StepOffset);
+    auto previousCellIndex = std::numeric_limits<uint32_t>::max();
+    for (uint32_t stepIndex = 0; stepIndex < pathEntry.StepCount; ++stepIndex)
+    {
+        const auto cellIndex = steps[stepIndex].Y / PathIndexCellSize * cellCountX + steps[stepIndex].X / PathIndexCellSize;
+        if (cellIndex == previousCellIndex)
+        {
+            continue;
+        }
+        previousCellIndex = cellIndex;
+
+        auto& cell = context.PathIndexCells[cellIndex];
+        cell.push_back(pathEntryId);
+
+        // 만료된 엔트리의 Id가 계속 쌓이지 않도록, 셀 크기가 2의 거듭제곱에 도달할 때마다 정리.
+        if (cell.size() >= PathIndexCellCompactSize && std::has_single_bit(cell.size()))
+        {
+            std::erase_if(cell,
+                          [&context](const uint32_t indexedPathEntryId)
+                          {
+                              return !context.AstarPathEntryPool.Get(indexedPathEntryId);
+                          });
+            std::ranges::sort(cell);
+            const auto [uniqueEnd, end] = std::ranges::unique(cell);
+            cell.erase(uniqueEnd, end);
+        }
+    }
+}
+
+bool G_Pathfinder::SearchPath(PerThreadContext& context,
+                              const U_TiledDatas<uint32_t>& costDatas,
+                              const Vector2i& from,
+                              const Vector2i& to,
+                              const uint32_t maxExpansions) const
+{
+    BeginSearch(context.AstarSearch, costDatas, from, to);
+    if (ContinueSearch(context.AstarSearch, costDatas, maxExpansions) != E_SearchResult::Found)
+    {
+        return false;
+    }
+
+    MakePath(context.AstarSearch, context.AstarPathMakerStack);
+    return true;
+}
+
+void G_Pathfinder::BeginSearch(SearchState& searchState,
+                               const U_TiledDatas<uint32_t>& costDatas,
+                               const Vector2i& from,
+                               const Vector2i& to)
+{
+    BeginSearch(searchState, costDatas, from, std::span{ &to, 1 });
+}
+
+void G_Pathfinder::BeginSearch(SearchState& searchState,
+                               const U_TiledDatas<uint32_t>& costDatas,
+                               const Vector2i& from,
+                               const std::span<const Vector2i> tos)
+{
+    searchState.Version += 1;
+    searchState.ExpansionCount = 0;
+    searchState.From = from;
+    searchState.To = tos.empty() ? from : tos.front();
+
+    const auto mapSize = costDatas.GetSize();
+    ResizeSearchState(searchState, mapSize);
+
+    /// FROM, TO 범위 체크 ....
+
+    // Queue는 처음 넣은 키를 기준으로 버킷을 잡으므로, H가 가장 작은 시작 노드를 먼저 넣음.
+    searchState.Queue.Reset();
+    const Vector2i* nearestTo = nullptr;
+    for (const auto& to : tos)
+    {
+        if (IsValidPosition(mapSize, to) && (!nearestTo || GetH(from, to) < GetH(from, *nearestTo)))
+        {
+            nearestTo = &to;
+        }
+    }
+
+    if (!nearestTo)
+    {
+        return;
+    }
+
+    const auto pushTo = [&searchState, &from](const Vector2i& to)
+    {
+        const auto toTileIndex = searchState.GetTileIndex(to);
+        if (searchState.Nodes[toTileIndex].Version == searchState.Version)
+        {
+            return;
+        }
+        searchState.Nodes[toTileIndex] = AstarSearchNode{ searchState.Version, 0 };
+        searchState.ParentDirections[toTileIndex] = SearchState::NullDirection;
+        searchState.Queue.Push(GetH(from, to), toTileIndex);
+    };
+    pushTo(*nearestTo);
+    for (const auto& to : tos)
+    {
+        if (IsValidPosition(mapSize, to))
+        {
+            pushTo(to);
+        }
+    }
+}
+
+void G_Pathfinder::ResizeSearchState(SearchState& searchState, const Vector2i& mapSize)
+{
+    if (searchState.MapSize == mapSize)
+    {
+        return;
+    }
+
+    searchState.MapSize = mapSize;
+    searchState.Nodes.assign(static_cast<size_t>(mapSize.x) * mapSize.y, AstarSearchNode{ 0, 0 });
+    searchState.ParentDirections.assign(static_cast<size_t>(mapSize.x) * mapSize.y, SearchState::NullDirection);
+    // 맵을 가로질러 크게 돌아가는 탐색에서 F가 H의 처음 값보다 커지는 폭이 이 정도임. 미로처럼 더 커지면 그때 늘어남.
+    searchState.Queue.Reserve(static_cast<uint32_t>(mapSize.x * mapSize.y), static_cast<uint32_t>(16 * (mapSize.x + mapSize.y)));
+    searchState.Version = 1;
+}
+
+size_t G_Pathfinder::GetSearchStateBytes(const SearchState& searchState)
+{
+    return searchState.Nodes.capacity() * sizeof(AstarSearchNode)
+           + searchState.ParentDirections.capacity() * sizeof(uint8_t)
+           + searchState.Queue.GetCapacityBytes();
+}
+
+G_Pathfinder::E_SearchResult G_Pathfinder::ContinueSearch(SearchState& searchState,
+                                                          const U_TiledDatas<uint32_t>& costDatas,
+                                                          const uint32_t maxExpansions)
+{
+    const auto fromTileIndex = searchState.GetTileIndex(searchState.From);
+
+    for (uint32_t expansionCount = 0;
+         !searchState.Queue.IsEmpty() && searchState.Nodes[fromTileIndex].Version != searchState.Version;
+         ++expansionCount)
+    {
+        if (expansionCount == maxExpansions)
+        {
+            return E_SearchResult::Suspended;
+        }
+
+        ExpandNode(searchState, costDatas, searchState.Queue.Pop());
+    }
+
+    return searchState.Nodes[fromTileIndex].Version == searchState.Version
+               ? E_SearchResult::Found
+               : E_SearchResult::NotFound;
+}
+
+void G_Pathfinder::ExpandNode(SearchState& searchState,
+                              const U_TiledDatas<uint32_t>& costDatas,
+                              const uint32_t currentTileIndex)
+{
+    const auto& mapSize = searchState.MapSize;
+    const auto& from = searchState.From;
+    const auto currentPosition = Vector2i{ static_cast<int32_t>(currentTileIndex % mapSize.x),
+                                           static_cast<int32_t>(currentTileIndex / mapSize.x) };
+    const auto currentG = searchState.Nodes[currentTileIndex].G;
+    searchState.ExpansionCount += 1;
+
+    for (uint8_t direction = 0; direction < std::size(DirectionOffsets); ++direction)
+    {
+        const auto [offsetX, offsetY] = DirectionOffsets[direction];
+        const auto nearPosition = currentPosition + Vector2i{ offsetX, offsetY };
+        if (!IsValidPosition(mapSize, nearPosition))
+        {
+            continue;
+        }
+
+        const auto nearTileIndex = searchState.GetTileIndex(nearPosition);
+        auto& nearSearchNode = searchState.Nodes[nearTileIndex];
+        if (nearSearchNode.Version == searchState.Version
+            || costDatas.GetDataAt(nearPosition) == ImpassableCost)
+        {
+            continue;
+        }
+        //
+        // TODO 현재 벽, 지형지물 등 bool 기반의 장애물 체계에서 비용 기반 체계 변경 중
+        // TODO 통행 불가(ImpassableCost) 외의 비용을 G에 반영하는 코드 여기 삽입할 것
+        //
+        nearSearchNode.Version = searchState.Version;
+        nearSearchNode.G = currentG + (offsetX != 0 && offsetY != 0 ? 14 : 10);
+        searchState.ParentDirections[nearTileIndex] = direction;
+        searchState.Queue.Push(nearSearchNode.G + GetH(from, nearPosition), nearTileIndex);
+    }
+}
+
+void G_Pathfinder::MakePath(const SearchState& searchState, std::vector<PathStep>& pathMakerStack)
+{
+    // 탐색이 to에서 from 방향으로 진행되므로, from부터 부모 방향을 거슬러 올라가며 쌓은 순서가 곧 경로 순서임.
+    pathMakerStack.clear();
+    AppendParentChain(searchState, searchState.From, pathMakerStack);
+}
+
+void G_Pathfinder::AppendParentChain(const SearchState& searchState,
+                                     const Vector2i& begin,
+                                     std::vector<PathStep>& pathMakerStack)
+{
+    for (auto currentPosition = begin; ;)
+    {
+        pathMakerStack.push_back(PathStep
             {
-                nextNode = currentNode->Next;
-                threadContext.AstarPathNodePool.Release(currentNode);
-            }
+                static_cast<uint16_t>(currentPosition.x),
+                static_cast<uint16_t>(currentPosition.y)
+            });
 
-            threadContext.AstarPathEntryPool.EraseBySparseIndex(pathEntryId);
+        const auto parentDirection = searchState.ParentDirections[searchState.GetTileIndex(currentPosition)];
+        if (parentDirection == SearchState::NullDirection)
+        {
+            break;
         }
+
+        const auto [offsetX, offsetY] = DirectionOffsets[parentDirection];
+        currentPosition = currentPosition - Vector2i{ offsetX, offsetY };
     }
 }
+
+void G_Pathfinder::WritePathSteps(const PerThreadContext& context, PathStep* const steps)
+{
+    std::ranges::copy(context.AstarPathMakerStack, steps);
+}
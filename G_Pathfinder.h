@@ -5,14 +5,24 @@
 #ifndef CORE_F_PATHFINDER_H
 #define CORE_F_PATHFINDER_H
 
+#include "F_Task.h"
+#include "F_Threads.h"
 #include "I_GlobalObject.h"
 #include "M_Pathfind.h"
-#include "U_PriorityQueue.h"
 #include "U_TiledDatas.h"
 #include "U_MemoryPool/SparseArray.h"
-#include "U_MemoryPool/FreeListPool.h"
+#include <godot_cpp/variant/rect2i.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
+#include <vector>
 
 namespace Core
 {
@@ -26,6 +36,7 @@ namespace Core
 
 namespace Core
 {
+    class F_ConnectivityIndex;
     class F_Executor;
 
     struct G_Pathfinder final : I_GlobalObject
@@ -33,85 +44,587 @@ namespace Core
         GLOBAL_OBJECT(Core, G_Pathfinder)
 
     private:
+        class PathfindAwaiter;
+
 #pragma pack(push, 1)
-        struct PathNode final
+        struct PathStep final
         {
             uint16_t X;
             uint16_t Y;
-            PathNode* Next;
         };
 
+        /**
+         * 경로는 PathStepSlab의 StepOffset 핸들이 가리키는 StepCount개의 연속된 Step에 저장되며, Cursor는 현재 진행 중인 Step의 인덱스.
+         * IsPending은 RequestPathfind()로 요청되어 아직 탐색되지 않은 엔트리임을 의미함.
+         */
         struct PathEntry final // NOLINT(*-pro-type-member-init)
         {
             uint64_t ExpiryWorldTick;
-            PathNode* Head;
-            PathNode* Current;
+            uint32_t StepOffset;
+            uint32_t StepCount;
+            uint32_t Cursor;
+            bool IsPending;
             godot::Vector2i From;
             godot::Vector2i To;
         };
 
+        /**
+         * 확장 중 매번 접근하는 값만 모은 탐색 노드. 위치는 배열 인덱스로, H는 필요할 때 계산하며, 부모는 SearchState::ParentDirections에 따로 둠.
+         */
         struct AstarSearchNode // NOLINT(*-pro-type-member-init)
         {
-            godot::Vector2i CurrentPosition;
-            godot::Vector2i NextPosition;
-            uint32_t G;
-            uint32_t H;
             uint32_t Version;
+            uint32_t G;
         };
 
 #pragma pack(pop)
 
-        struct SearchNodeComparator
+        struct PathRequest final
+        {
+            uint32_t OwnerThreadId;
+            uint32_t PathEntryId;
+            uint32_t Priority;
+            uint32_t SearchStateIndex; // 진행 중인 탐색이 없으면 NullSearchStateIndex.
+            bool IsCompleted;
+            bool IsCostChanged; // 탐색 도중 RepairPaths()가 호출되었다면 true. 완료 시 경로를 다시 검사함.
+            godot::Vector2i From;
+            godot::Vector2i To;
+            PathfindAwaiter* Awaiter; // PathfindAsync()의 요청이면 완료 후 재개할 코루틴의 Awaiter, 아니면 nullptr.
+        };
+
+        /**
+         * 워커가 처리한 요청의 결과. Step들은 처리한 워커의 CompletedPathSteps[StepBegin, StepBegin + StepCount)에 있음.
+         */
+        struct CompletedPathRequest final
+        {
+            uint32_t RequestIndex;
+            uint32_t OwnerThreadId;
+            uint32_t PathEntryId;
+            uint32_t StepBegin;
+            uint32_t StepCount;
+        };
+
+        /**
+         * F(= G + H)를 키로 하는 Bucket Queue. 비용이 작은 정수이므로 키마다 버킷을 두고, 커서를 앞으로만 옮기며 꺼냄.
+         * A* 탐색 중 꺼내지는 F는 줄어들지 않으므로, 커서보다 작은 키는 커서 위치의 버킷에 넣음.
+         * 탐색은 한 타일을 한 번만 넣으므로, 버킷은 타일 인덱스마다 다음 타일을 가리키는 배열로 이은 리스트로 둠.
+         * 넣고 꺼낼 때는 할당하지 않으며, 버킷 수가 Reserve()한 것보다 많아질 때만 버킷 배열이 커짐.
+         */
+        class SearchBucketQueue final
         {
-            bool operator()(const AstarSearchNode* const lhs, const AstarSearchNode* const rhs) const
+        public:
+            /**
+             * tileCount개의 타일과 bucketCount개의 버킷을 담을 공간을 할당. Push()하는 타일 인덱스는 tileCount보다 작아야 함.
+             */
+            void Reserve(const uint32_t tileCount, const uint32_t bucketCount)
+            {
+                nextTileIndices_.resize(tileCount);
+                if (bucketHeads_.size() < bucketCount)
+                {
+                    bucketHeads_.resize(bucketCount, NullTileIndex);
+                }
+            }
+
+            void Reset()
             {
-                return lhs->G + lhs->H < rhs->G + rhs->H;
+                std::fill(bucketHeads_.begin() + cursor_, bucketHeads_.begin() + usedBucketCount_, NullTileIndex);
+                cursor_ = 0;
+                usedBucketCount_ = 0;
+                count_ = 0;
             }
+
+            /**
+             * Reset() 이후 같은 타일을 두 번 넣지 말 것.
+             */
+            void Push(const uint32_t key, const uint32_t tileIndex)
+            {
+                if (count_ == 0 && usedBucketCount_ == 0)
+                {
+                    baseKey_ = key;
+                }
+
+                const auto bucketIndex = std::max(key > baseKey_ ? key - baseKey_ : 0, cursor_);
+                if (bucketIndex >= bucketHeads_.size())
+                {
+                    bucketHeads_.resize(std::max<size_t>(bucketIndex + 1, bucketHeads_.size() * 2), NullTileIndex);
+                }
+                usedBucketCount_ = std::max(usedBucketCount_, bucketIndex + 1);
+                nextTileIndices_[tileIndex] = bucketHeads_[bucketIndex];
+                bucketHeads_[bucketIndex] = tileIndex;
+                count_ += 1;
+            }
+
+            [[nodiscard]]
+            uint32_t Pop()
+            {
+                while (bucketHeads_[cursor_] == NullTileIndex)
+                {
+                    cursor_ += 1;
+                }
+
+                const auto tileIndex = bucketHeads_[cursor_];
+                bucketHeads_[cursor_] = nextTileIndices_[tileIndex];
+                count_ -= 1;
+                return tileIndex;
+            }
+
+            [[nodiscard]]
+            bool IsEmpty() const
+            {
+                return count_ == 0;
+            }
+
+            [[nodiscard]]
+            size_t GetCapacityBytes() const
+            {
+                return (nextTileIndices_.capacity() + bucketHeads_.capacity()) * sizeof(uint32_t);
+            }
+
+        private:
+            static constexpr uint32_t NullTileIndex = 0xffffffff;
+
+            std::vector<uint32_t> nextTileIndices_;
+            std::vector<uint32_t> bucketHeads_; // 각 버킷에 마지막으로 넣은 타일. 비었으면 NullTileIndex.
+            uint32_t baseKey_{ 0 };
+            uint32_t cursor_{ 0 };
+            uint32_t usedBucketCount_{ 0 };
+            uint32_t count_{ 0 };
         };
 
+        /**
+         * 스레드별로 경로의 Step들을 저장하는 Slab. 고정 크기 페이지를 2의 거듭제곱 크기 단위의 구간으로 나누어 할당하고,
+         * 크기 단위별 Free List를 두어 할당과 해제를 모두 O(1)로 처리함. 페이지보다 긴 경로는 그 길이의 전용 페이지를 받음.
+         * 페이지는 해제 전까지 옮기거나 다시 할당하지 않으므로 핸들이 가리키는 주소가 유지되며, 다른 스레드가 GetPathContext()로
+         * 읽는 동안 소유 스레드가 새 구간을 할당해도 읽는 쪽의 메모리는 바뀌지 않음.
+         * 핸들은 상위 비트가 페이지 Index, 하위 PageShift 비트가 페이지 안의 위치임.
+         */
+        class PathStepSlab final
+        {
+        public:
+            [[nodiscard]]
+            uint32_t Acquire(const uint32_t stepCount)
+            {
+                if (stepCount > PageStepCount)
+                {
+                    return AllocatePage(stepCount) << PageShift;
+                }
+
+                const auto sizeClass = GetSizeClass(stepCount);
+                auto& freeHandles = freeHandlesPerSizeClass_[sizeClass];
+                if (!freeHandles.empty())
+                {
+                    const auto handle = freeHandles.back();
+                    freeHandles.pop_back();
+                    return handle;
+                }
+
+                const auto capacity = MinCapacity << sizeClass;
+                if (currentPageUsedStepCount_ + capacity > PageStepCount)
+                {
+                    RecycleCurrentPageTail();
+                    if (!reservedPageIndices_.empty())
+                    {
+                        currentPageIndex_ = reservedPageIndices_.back();
+                        reservedPageIndices_.pop_back();
+                    }
+                    else
+                    {
+                        currentPageIndex_ = AllocatePage(PageStepCount);
+                    }
+                    currentPageUsedStepCount_ = 0;
+                }
+
+                const auto handle = currentPageIndex_ << PageShift | currentPageUsedStepCount_;
+                currentPageUsedStepCount_ += capacity;
+                return handle;
+            }
+
+            void Release(const uint32_t handle, const uint32_t stepCount)
+            {
+                if (stepCount > PageStepCount)
+                {
+                    const auto pageIndex = handle >> PageShift;
+                    GetPage(pageIndex).reset();
+                    allocatedStepCount_ -= stepCount;
+                    freePageIndices_.push_back(pageIndex);
+                    return;
+                }
+
+                freeHandlesPerSizeClass_[GetSizeClass(stepCount)].push_back(handle);
+            }
+
+            [[nodiscard]]
+            PathStep* GetSteps(const uint32_t handle)
+            {
+                return GetPage(handle >> PageShift).get() + (handle & PageOffsetMask);
+            }
+
+            [[nodiscard]]
+            const PathStep* GetSteps(const uint32_t handle) const
+            {
+                return GetPage(handle >> PageShift).get() + (handle & PageOffsetMask);
+            }
+
+            /**
+             * 아직 나누어 주지 않은 페이지들의 용량이 stepCount 이상이 되도록 페이지를 미리 할당.
+             */
+            void Reserve(const uint32_t stepCount)
+            {
+                while ((reservedPageIndices_.size() + 1) * PageStepCount - currentPageUsedStepCount_ < stepCount)
+                {
+                    reservedPageIndices_.push_back(AllocatePage(PageStepCount));
+                }
+            }
+
+            [[nodiscard]]
+            size_t GetCapacityBytes() const
+            {
+                auto capacityBytes = allocatedStepCount_ * sizeof(PathStep)
+                                     + freePageIndices_.capacity() * sizeof(uint32_t)
+                                     + reservedPageIndices_.capacity() * sizeof(uint32_t);
+                for (const auto& pageChunk : pageChunks_)
+                {
+                    capacityBytes += pageChunk ? PagesPerChunk * sizeof(Page) : 0;
+                }
+                for (const auto& freeHandles : freeHandlesPerSizeClass_)
+                {
+                    capacityBytes += freeHandles.capacity() * sizeof(uint32_t);
+                }
+                return capacityBytes;
+            }
+
+        private:
+            using Page = std::unique_ptr<PathStep[]>;
+
+            static constexpr uint32_t MinCapacity = 8;
+            static constexpr uint32_t PageShift = 12;
+            static constexpr uint32_t PageStepCount = 1 << PageShift;
+            static constexpr uint32_t PageOffsetMask = PageStepCount - 1;
+            static constexpr uint32_t SizeClassCount = PageShift - 2; // MinCapacity(8) ~ PageStepCount
+            static constexpr uint32_t MaxPageCount = 1u << (32 - PageShift);
+            static constexpr uint32_t PagesPerChunk = 1024;
+
+            // 페이지 표. 덩어리 단위로만 늘어나며 이미 만든 덩어리는 옮기지 않으므로, 읽는 쪽이 보는 페이지 포인터도 유지됨.
+            std::array<std::unique_ptr<Page[]>, MaxPageCount / PagesPerChunk> pageChunks_;
+            std::array<std::vector<uint32_t>, SizeClassCount> freeHandlesPerSizeClass_;
+            std::vector<uint32_t> freePageIndices_; // 반납된 전용 페이지의 Index.
+            std::vector<uint32_t> reservedPageIndices_; // Reserve()로 할당해 두고 아직 나누어 주지 않은 페이지.
+            uint32_t pageCount_{ 0 };
+            uint32_t currentPageIndex_{ 0 };
+            uint32_t currentPageUsedStepCount_{ PageStepCount };
+            size_t allocatedStepCount_{ 0 };
+
+            [[nodiscard]]
+            Page& GetPage(const uint32_t pageIndex) const
+            {
+                return pageChunks_[pageIndex / PagesPerChunk][pageIndex % PagesPerChunk];
+            }
+
+            [[nodiscard]]
+            uint32_t AllocatePage(const uint32_t stepCount)
+            {
+                uint32_t pageIndex;
+                if (!freePageIndices_.empty())
+                {
+                    pageIndex = freePageIndices_.back();
+                    freePageIndices_.pop_back();
+                }
+                else
+                {
+                    SCRASH_COND(pageCount_ >= MaxPageCount);
+                    pageIndex = pageCount_++;
+                    auto& pageChunk = pageChunks_[pageIndex / PagesPerChunk];
+                    if (!pageChunk)
+                    {
+                        pageChunk = std::make_unique<Page[]>(PagesPerChunk);
+                    }
+                }
+
+                GetPage(pageIndex) = std::make_unique_for_overwrite<PathStep[]>(stepCount);
+                allocatedStepCount_ += stepCount;
+                return pageIndex;
+            }
+
+            /**
+             * 현재 페이지에서 나누어 주지 못한 끝부분을 2의 거듭제곱 구간들로 잘라 Free List에 넣음.
+             */
+            void RecycleCurrentPageTail()
+            {
+                while (PageStepCount - currentPageUsedStepCount_ >= MinCapacity)
+                {
+                    const auto capacity = std::bit_floor(PageStepCount - currentPageUsedStepCount_);
+                    freeHandlesPerSizeClass_[GetSizeClass(capacity)].push_back(
+                        currentPageIndex_ << PageShift | currentPageUsedStepCount_);
+                    currentPageUsedStepCount_ += capacity;
+                }
+            }
+
+            [[nodiscard]]
+            static uint32_t GetSizeClass(const uint32_t stepCount)
+            {
+                return stepCount <= MinCapacity
+                           ? 0
+                           : std::bit_width(stepCount - 1) - std::bit_width(MinCapacity - 1);
+            }
+        };
+
+        enum class E_SearchResult : uint8_t
+        {
+            Found,
+            NotFound,
+            Suspended,
+        };
+
+        /**
+         * 하나의 A* 탐색이 진행되는 데 필요한 모든 상태. 이 상태를 보존하면 탐색을 중단했다가 이후 틱에서 이어서 진행할 수 있음.
+         */
+        struct SearchState
+        {
+            static constexpr uint8_t NullDirection = 0xff;
+
+            uint32_t Version;
+            uint32_t ExpansionCount; // 현재 탐색에서 확장한 노드 수.
+            SearchBucketQueue Queue;
+            std::vector<AstarSearchNode> Nodes; // 타일 인덱스(y * MapSize.x + x) 순.
+            std::vector<uint8_t> ParentDirections; // 부모 노드에서 이 노드로 올 때 사용한 DirectionOffsets의 인덱스.
+            godot::Vector2i MapSize;
+            godot::Vector2i From;
+            godot::Vector2i To;
+
+            [[nodiscard]]
+            uint32_t GetTileIndex(const godot::Vector2i& position) const
+            {
+                return static_cast<uint32_t>(position.y * MapSize.x + position.x);
+            }
+        };
+
+    public:
+#if defined(CORE_PATHFINDER_SEARCH_TIMING) || !defined(NDEBUG)
+        static constexpr bool IsSearchTimingEnabled = true;
+#else
+        static constexpr bool IsSearchTimingEnabled = false;
+#endif
+
+        /**
+         * 스레드별로 누적되는 탐색 통계. 게임 내에서 맵이나 탐색 방식을 바꿨을 때의 효과를 측정하는 용도.
+         * 지연 시간은 2의 거듭제곱 나노초 단위의 Histogram으로 기록됨. LatencyHistogram[i]는 [2^(i - 1), 2^i) 나노초.
+         * 지연 시간은 탐색마다 시계를 두 번 읽어야 하므로 IsSearchTimingEnabled일 때(디버그 빌드 또는 CORE_PATHFINDER_SEARCH_TIMING을
+         * 정의한 빌드)만 기록되며, 그 외에는 TotalNanoseconds와 LatencyHistogram이 0으로 남음.
+         */
+        struct SearchStatistics final
+        {
+            static constexpr size_t LatencyBucketCount = 40;
+
+            uint64_t SearchCount;
+            uint64_t FoundCount;
+            uint64_t ExpansionCount;
+            uint64_t PathStepCount;
+            uint64_t TotalNanoseconds;
+            std::array<uint64_t, LatencyBucketCount> LatencyHistogram;
+
+            /**
+             * @param percentile 0.5, 0.99 등
+             * @return 해당 백분위수가 속한 Histogram 구간의 상한. 지연 시간을 기록하지 않는 빌드에서는 0.
+             */
+            [[nodiscard]]
+            uint64_t GetLatencyPercentileNanoseconds(double percentile) const;
+        };
+
+    private:
+        // 엔트리는 접근될 때마다 2 * PathEntryRefreshIntervalWorldTick 이후로 만료가 미뤄지므로, 그보다 큰 크기의 Wheel이면 충분함.
+        static constexpr uint64_t ExpiryWheelSize = std::bit_ceil(2 * M_Pathfind::PathEntryRefreshIntervalWorldTick + 2);
+
+        /**
+         * F_PerThread가 스레드마다 캐시 라인 단위로 떨어뜨려 보관하므로, 인접한 스레드의 컨텍스트 헤더(각 vector의 포인터, 크기 등)와 False Sharing이 발생하지 않음.
+         */
         struct PerThreadContext
         {
-            uint32_t AstarSearchVersion;
-            U_PriorityQueue<AstarSearchNode*, SearchNodeComparator> AstarSearchQueue;
-            U_TiledDatas<AstarSearchNode> AstarSearchNodes;
-            std::vector<AstarSearchNode*> AstarPathMakerStack;
-            U_MemoryPool::FreeListPool<PathNode> AstarPathNodePool;
+            SearchState AstarSearch;
+            std::unique_ptr<SearchState> AstarBidirectionalSearch; // 양방향 탐색의 from 쪽 탐색. WarmUp() 또는 처음 사용될 때 할당.
+            std::vector<PathStep> AstarPathMakerStack;
+            PathStepSlab AstarPathStepSlab;
             U_MemoryPool::SparseArray<PathEntry> AstarPathEntryPool;
+            std::vector<PathRequest> PendingPathRequests;
+            std::vector<CompletedPathRequest> CompletedPathRequests;
+            std::vector<PathStep> CompletedPathSteps;
+
+            // 타일 -> 경로 공간 인덱스. PathIndexCellSize 크기의 셀마다 그 셀을 지나는 PathEntry의 Id 목록을 가짐.
+            // 만료된 엔트리는 즉시 제거하지 않으며, 셀이 커질 때 정리함.
+            uint32_t PathIndexCellCountX;
+            std::vector<std::vector<uint32_t>> PathIndexCells;
+            std::vector<uint32_t> RepairCandidatePathEntryIds;
+            std::vector<PathStep> RepairPathSteps;
+
+            // 만료 처리용 Timing Wheel. 모든 엔트리는 NewPathEntryIds 또는 ExpiryWheel 중 정확히 한 곳에 자신의 Id를 가짐.
+            std::vector<uint32_t> NewPathEntryIds;
+            std::array<std::vector<uint32_t>, ExpiryWheelSize> ExpiryWheel;
+            std::vector<uint32_t> ExpiringPathEntryIds;
+            std::optional<uint64_t> ExpiredWorldTick; // 이 틱까지의 칸은 처리 완료됨. 첫 Process() 전에는 비어 있음.
+
+            SearchStatistics Statistics;
         };
 
     public:
+        /**
+         * 스레드 컨텍스트 하나가 현재 확보하고 있는 메모리(capacity 기준, 바이트). PathEntry 풀은 포함하지 않음.
+         */
+        struct MemoryUsage final
+        {
+            size_t SearchBytes; // 동기 탐색용 SearchState들(양방향 탐색 포함)과 경로 생성 버퍼.
+            size_t ResumableSearchBytes; // 이 스레드가 WarmUp()에서 맡은 ProcessPathRequests()용 SearchState들.
+            size_t PathStepBytes;
+            size_t PathIndexBytes;
+            size_t RequestBytes; // 요청 대기열과 완료 결과 버퍼.
+        };
+
         struct PathContext final
         {
             godot::Vector2i From;
             godot::Vector2i To;
             std::optional<godot::Vector2i> Current;
+            bool IsPending;
         };
 
+        static constexpr uint32_t DefaultExpansionBudgetPerRequest = 4096;
+        static constexpr uint32_t MaxRepairExpansionCount = 16384;
+        static constexpr uint32_t ImpassableCost = std::numeric_limits<uint32_t>::max();
+
         explicit G_Pathfinder();
 
+        /**
+         * 각 스레드의 탐색 노드 배열과 Bucket Queue(양방향 탐색용 포함), 경로 버퍼, PathEntry 풀, 경로 공간 인덱스와
+         * ProcessPathRequests()용 SearchState들을 mapSize에 맞게 미리 할당.
+         * 각 스레드의 메모리는 그 스레드에서 직접 할당하고 초기화하므로(First Touch), 첫 탐색 시의 지연이 사라지고 해당 스레드의 NUMA 노드에 페이지가 놓임.
+         * 맵을 불러온 직후와 같이 틱 사이에 메인 스레드에서 호출할 것.
+         * @param context
+         * @param mapSize
+         */
+        void WarmUp(const F_MutableContext& context, const godot::Vector2i& mapSize);
+
+        [[nodiscard]]
+        MemoryUsage GetMemoryUsage(uint32_t threadId) const;
+
+        /**
+         * 모든 스레드의 탐색 통계를 합산. Pathfind 계열 함수와 ProcessPathRequests()에서 완료된 탐색만 집계하며, RepairPaths()의 부분 탐색은 포함하지 않음.
+         * 다른 스레드에서 탐색이 진행되지 않는 시점에 메인 스레드에서 호출할 것.
+         */
+        [[nodiscard]]
+        SearchStatistics GetSearchStatistics() const;
+
+        void ResetSearchStatistics();
+
         [[nodiscard]]
         M_Pathfind::PathHandle Pathfind(const U_TiledDatas<uint32_t>& costDatas,
                                         const godot::Vector2i& from,
                                         const godot::Vector2i& to) const;
 
+        /**
+         * targets 중 from에서 가장 가까운 타일까지의 경로를 탐색. 모든 target을 시작 노드로 하여 한 번의 탐색으로 처리하며,
+         * 반환된 경로의 PathContext::To는 실제로 도달하게 된 target임.
+         */
+        [[nodiscard]]
+        M_Pathfind::PathHandle PathfindToNearest(const U_TiledDatas<uint32_t>& costDatas,
+                                                 const godot::Vector2i& from,
+                                                 std::span<const godot::Vector2i> targets) const;
+
+        /**
+         * from과 to 양쪽에서 번갈아 탐색하여 두 탐색이 만나는 지점에서 경로를 완성. 먼 거리의 경로에서 확장 노드 수가 크게 줄어듦.
+         * @remarks 두 탐색이 처음 만난 지점에서 종료하므로, Pathfind()보다 경로가 약간 길 수 있음.
+         */
+        [[nodiscard]]
+        M_Pathfind::PathHandle PathfindBidirectional(const U_TiledDatas<uint32_t>& costDatas,
+                                                     const godot::Vector2i& from,
+                                                     const godot::Vector2i& to) const;
+
+        /**
+         * RequestPathfind()와 같은 요청을 올리고, ProcessPathRequests()가 그 요청을 끝내면 쉬고 있는 워커에서 co_await한 코루틴을
+         * 재개함. 탐색은 틱 단계의 ProcessPathRequests()에서만 진행되므로, 백그라운드 작업이 스레드별 저장소를 건드리지 않음.
+         * 기다리는 동안 코루틴은 스레드를 점유하지 않음.
+         * @remarks 탐색에는 ProcessPathRequests()에 넘긴 costDatas가 사용되므로, 코루틴이 재개될 때까지 ProcessPathRequests()에는
+         * 같은 맵을 넘기고 그 호출 도중에는 맵을 수정하지 말 것.
+         * 반환된 경로는 메인 스레드의 저장소에 있으므로, GetPathContext() 등은 재개된 코루틴이 아니라 틱 단계의 코드에서 사용할 것.
+         * 워커가 없는 F_Executor에서는 요청을 끝낸 ProcessPathRequests() 호출의 마지막에, 그 호출을 한 스레드에서 재개됨.
+         */
+        [[nodiscard]]
+        F_Task<M_Pathfind::PathHandle> PathfindAsync(F_Executor& executor,
+                                                     godot::Vector2i from,
+                                                     godot::Vector2i to,
+                                                     uint32_t priority) const;
+
+        /**
+         * 경로 탐색을 요청하고 즉시 PathHandle을 반환함. 실제 탐색은 ProcessPathRequests()에서 메인 스레드와 워커 스레드들이 수행하며,
+         * 그 전까지 GetPathContext()는 IsPending이 true인 PathContext를 반환함.
+         * @param priority 클수록 먼저 처리됨.
+         */
+        [[nodiscard]]
+        M_Pathfind::PathHandle RequestPathfind(const godot::Vector2i& from,
+                                               const godot::Vector2i& to,
+                                               uint32_t priority) const;
+
         [[nodiscard]]
         bool CanReach(const U_TiledDatas<uint32_t>& floodFill, const godot::Vector2i& from, const godot::Vector2i& to) const;
 
+        /**
+         * 맵 전체 Flood Fill 결과 대신, 지형 변경이 국소적으로 반영되는 F_ConnectivityIndex를 이용하여 도달 가능 여부를 판정.
+         */
+        [[nodiscard]]
+        bool CanReach(const F_ConnectivityIndex& connectivityIndex, const godot::Vector2i& from, const godot::Vector2i& to) const;
+
         /**
          * 내부적으로 만료된 엔트리 삭제 등을 진행.
+         * 모든 엔트리를 순회하지 않고, 이번 틱에 만료될 예정이었던 엔트리만 Timing Wheel에서 꺼내어 확인함.
+         * 스레드별 저장소 하나를 블록 하나로 하여 메인 스레드와 워커들이 함께 나누어 처리함.
          * @param context
          */
         void Process(const F_MutableContext& context);
 
+        /**
+         * RequestPathfind(), PathfindAsync()로 쌓인 요청들을 우선순위 순으로 메인 스레드와 워커 스레드들에 분배하여 처리.
+         * 워커가 없는 F_Executor에서는 메인 스레드가 모든 요청을 처리함.
+         * timeBudget이 지나면 새 요청을 가져가지 않으며, 남은 요청은 다음 호출에서 이어서 처리됨.
+         * 한 요청의 탐색은 한 번의 호출에서 최대 expansionBudgetPerRequest개의 노드만 확장하고 중단되며, 다음 호출에서 이어서 진행됨.
+         * 이어서 진행할 수 있는 탐색의 수는 스레드 수에 비례하여 제한되므로, 모두 사용 중일 때 더 높은 우선순위의 요청이 들어오면
+         * 가장 낮은 우선순위의 진행 중 탐색을 중단시키고 그 상태를 넘겨받음. 중단된 요청은 나중에 처음부터 다시 탐색함.
+         * 탐색을 끝낸 스레드는 그 상태로 기다리던 다음 요청을 바로 시작하므로, 한 번의 호출에서 끝내는 요청 수는 상태의 수가 아니라
+         * timeBudget으로 제한됨.
+         * @param context
+         * @param costDatas
+         * @param timeBudget
+         * @param expansionBudgetPerRequest
+         */
+        void ProcessPathRequests(const F_MutableContext& context,
+                                 const U_TiledDatas<uint32_t>& costDatas,
+                                 std::chrono::microseconds timeBudget,
+                                 uint32_t expansionBudgetPerRequest = DefaultExpansionBudgetPerRequest);
+
+        /**
+         * 비용이 변경된 영역을 알림. 메인 스레드에서만 호출하며, 실제 경로 수정은 RepairPaths()에서 이루어짐.
+         * @param dirtyRect
+         */
+        void NotifyCostsChanged(const godot::Rect2i& dirtyRect)
+        {
+            dirtyRects_.push_back(dirtyRect);
+        }
+
+        /**
+         * NotifyCostsChanged()로 알려진 영역을 지나는 경로들 중, 남은 구간이 ImpassableCost 타일을 지나게 된 경로만 찾아
+         * 막힌 구간의 앞뒤 Step 사이만 다시 탐색하여 이어 붙임. 구간 탐색은 최대 MaxRepairExpansionCount개의 노드만 확장하며,
+         * 그 안에 우회로를 찾지 못하면 경로를 비워 경로 없음으로 처리함.
+         * 아직 탐색 중인 요청의 경로는 ProcessPathRequests()에서 완료될 때 ImpassableCost 타일을 지나는지 검사하여, 지나면 처음부터 다시 탐색함.
+         * @param context
+         * @param costDatas
+         */
+        void RepairPaths(const F_MutableContext& context, const U_TiledDatas<uint32_t>& costDatas);
+
         void AdvancePath(const M_Pathfind::PathHandle pathHandle, const uint64_t currentWorldTick)
         {
             const auto pathEntry = GetPathEntry(pathHandle, currentWorldTick);
-            if (!pathEntry || !pathEntry->Current)
+            if (!pathEntry || pathEntry->Cursor >= pathEntry->StepCount)
             {
                 return;
             }
 
-            pathEntry->Current = pathEntry->Current->Next;
+            pathEntry->Cursor += 1;
         }
 
         [[nodiscard]]
@@ -123,18 +636,44 @@ namespace Core
                 return std::nullopt;
             }
 
+            if (pathEntry->Cursor >= pathEntry->StepCount)
+            {
+                return PathContext{ pathEntry->From, pathEntry->To, std::nullopt, pathEntry->IsPending };
+            }
+
+            const auto& currentStep = PerThreadContexts[pathHandle.GetPathHandlerThreadId()].AstarPathStepSlab.GetSteps(
+                pathEntry->StepOffset)[pathEntry->Cursor];
             return PathContext
             {
                 pathEntry->From,
                 pathEntry->To,
-                pathEntry->Current != nullptr
-                    ? std::make_optional<godot::Vector2i>(pathEntry->Current->X, pathEntry->Current->Y)
-                    : std::nullopt
+                std::make_optional<godot::Vector2i>(currentStep.X, currentStep.Y),
+                false
             };
         }
 
     private:
-        const std::unique_ptr<PerThreadContext[]> PerThreadContexts;
+        const F_PerThread<PerThreadContext> PerThreadContexts;
+
+        static constexpr uint32_t NullSearchStateIndex = 0xffffffff;
+        static constexpr int32_t PathIndexCellSize = 16;
+        static constexpr size_t PathIndexCellCompactSize = 64; // 셀의 Id 수가 이 크기 이상의 2의 거듭제곱이 될 때마다 만료된 Id를 정리함.
+        static constexpr uint32_t WarmUpPathEntryCount = 1024; // 엔트리 수는 맵이 아니라 경로를 쓰는 유닛 수를 따르므로 고정된 수만큼 미리 확보함.
+        static constexpr uint32_t ResumableSearchStatesPerThread = 2;
+
+        std::vector<PathRequest> pathRequestQueue_; // 탐색 중에는 SearchState를 주고받는 요청만 그 스레드가 수정하고, 나머지는 메인 스레드에서만 수정.
+        std::vector<uint32_t> activePathRequestIndices_; // 이번 호출에서 처리할, SearchState가 할당된 요청들의 인덱스.
+        std::vector<uint32_t> waitingPathRequestIndices_; // SearchState를 받지 못해 끝난 탐색의 SearchState를 기다리는 요청들의 인덱스.
+
+        // 요청 단위로 보존되는 탐색 상태. 맵 크기만큼의 메모리를 차지하므로 스레드 수에 비례하는 개수로 제한함.
+        std::vector<std::unique_ptr<SearchState>> resumableSearchStates_;
+        std::vector<uint32_t> freeResumableSearchStateIndices_;
+
+        std::vector<godot::Rect2i> dirtyRects_;
+
+        // PathfindAsync()로 들어와 아직 대기열에 옮기지 않은 요청들. 어느 스레드의 코루틴에서든 추가되므로 잠금으로 보호함.
+        mutable std::mutex asyncPathRequestsMutex_;
+        mutable std::vector<PathfindAwaiter*> asyncPathRequests_;
 
         [[nodiscard]]
         PathEntry* GetPathEntry(const M_Pathfind::PathHandle pathHandle, const uint64_t currentWorldTick) const
@@ -148,7 +687,119 @@ namespace Core
             return pathEntry;
         }
 
+        /**
+         * searchFound가 true이면 AstarPathMakerStack의 경로를 Slab에 옮겨 엔트리를 만들고, false이면 빈 경로의 엔트리를 만듦.
+         */
+        static M_Pathfind::PathHandle EmplacePathEntry(PerThreadContext& context,
+                                                       uint32_t threadId,
+                                                       const U_TiledDatas<uint32_t>& costDatas,
+                                                       bool searchFound,
+                                                       const godot::Vector2i& from,
+                                                       const godot::Vector2i& to);
+
+        /**
+         * threadId의 저장소에 IsPending인 엔트리를 만들고, 그 요청을 threadId의 PendingPathRequests에 추가.
+         */
+        M_Pathfind::PathHandle EmplacePendingPathRequest(uint32_t threadId,
+                                                         const godot::Vector2i& from,
+                                                         const godot::Vector2i& to,
+                                                         uint32_t priority,
+                                                         PathfindAwaiter* awaiter) const;
+
         void ProcessImpl(uint32_t threadId, const F_ImmutableContext& context);
+
+        void WarmUpImpl(uint32_t threadId, const godot::Vector2i& mapSize);
+
+        void CreateResumableSearchStates();
+
+        /**
+         * 지연 시간을 기록하는 빌드에서만 시계를 읽음. 그 외에는 기본값을 반환하며 RecordSearch()도 이를 사용하지 않음.
+         */
+        static std::chrono::steady_clock::time_point GetSearchBeginTime()
+        {
+            if constexpr (IsSearchTimingEnabled)
+            {
+                return std::chrono::steady_clock::now();
+            }
+            else
+            {
+                return {};
+            }
+        }
+
+        static void RecordSearch(PerThreadContext& context,
+                                 std::chrono::steady_clock::time_point searchBeginTime,
+                                 bool searchFound,
+                                 uint64_t expansionCount);
+
+        void RepairPathsImpl(uint32_t threadId, const U_TiledDatas<uint32_t>& costDatas) const;
+
+        /**
+         * @return 경로가 수정되어 새로 인덱싱이 필요하면 true.
+         */
+        bool RepairPath(PerThreadContext& context, PathEntry& pathEntry, const U_TiledDatas<uint32_t>& costDatas) const;
+
+        static void IndexPath(PerThreadContext& context,
+                              uint32_t pathEntryId,
+                              const PathEntry& pathEntry,
+                              const godot::Vector2i& mapSize);
+
+        /**
+         * to에서 from 방향으로 최대 maxExpansions개의 노드를 확장하며 A* 탐색을 수행. 경로를 찾으면 from부터 to까지의 노드를
+         * AstarPathMakerStack에 채우고 true 반환.
+         */
+        bool SearchPath(PerThreadContext& context,
+                        const U_TiledDatas<uint32_t>& costDatas,
+                        const godot::Vector2i& from,
+                        const godot::Vector2i& to,
+                        uint32_t maxExpansions = std::numeric_limits<uint32_t>::max()) const;
+
+        static void BeginSearch(SearchState& searchState,
+                                const U_TiledDatas<uint32_t>& costDatas,
+                                const godot::Vector2i& from,
+                                const godot::Vector2i& to);
+
+        /**
+         * 탐색 노드 배열들을 mapSize에 맞게 다시 할당. 크기가 같으면 아무것도 하지 않음.
+         */
+        static void ResizeSearchState(SearchState& searchState, const godot::Vector2i& mapSize);
+
+        [[nodiscard]]
+        static size_t GetSearchStateBytes(const SearchState& searchState);
+
+        /**
+         * tos의 모든 타일을 G = 0인 시작 노드로 넣고 탐색을 시작. 맵 밖의 타일은 무시함.
+         */
+        static void BeginSearch(SearchState& searchState,
+                                const U_TiledDatas<uint32_t>& costDatas,
+                                const godot::Vector2i& from,
+                                std::span<const godot::Vector2i> tos);
+
+        /**
+         * currentTileIndex 노드의 방문하지 않은 이웃들을 큐에 넣음.
+         */
+        static void ExpandNode(SearchState& searchState, const U_TiledDatas<uint32_t>& costDatas, uint32_t currentTileIndex);
+
+        /**
+         * 최대 maxExpansions개의 노드를 확장하며 탐색을 진행. 그 안에 결론이 나지 않으면 Suspended를 반환하며, 같은 SearchState로 다시 호출하여 이어서 진행 가능.
+         */
+        static E_SearchResult ContinueSearch(SearchState& searchState,
+                                             const U_TiledDatas<uint32_t>& costDatas,
+                                             uint32_t maxExpansions);
+
+        /**
+         * 탐색이 Found로 끝난 SearchState로부터 from부터 to까지의 노드를 pathMakerStack에 채움.
+         */
+        static void MakePath(const SearchState& searchState, std::vector<PathStep>& pathMakerStack);
+
+        /**
+         * begin부터 부모 방향을 거슬러 시작 노드까지의 노드들을 pathMakerStack 뒤에 이어 붙임.
+         */
+        static void AppendParentChain(const SearchState& searchState,
+                                      const godot::Vector2i& begin,
+                                      std::vector<PathStep>& pathMakerStack);
+
+        static void WritePathSteps(const PerThreadContext& context, PathStep* steps);
     };
 }
 
@@ -4,13 +4,46 @@
 
 #include "F_Executor.h"
 #include "F_Threads.h"
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <string>
+
+#if __has_include(<godot_cpp/variant/utility_functions.hpp>)
 #include <godot_cpp/variant/utility_functions.hpp>
+#else
+#include <iostream>
+#endif
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 using namespace Core;
-using namespace godot;
+
+namespace
+{
+    /**
+     * 실행기 자체는 Godot에 의존하지 않으므로, Godot 없이 빌드할 때(프로파일링, Sanitizer 등)는 표준 출력으로 대신함.
+     */
+    template<typename... TArgs>
+    void Log(const TArgs&... args)
+    {
+#if __has_include(<godot_cpp/variant/utility_functions.hpp>)
+        godot::UtilityFunctions::print(args...);
+#else
+        (std::cout << ... << args) << std::endl;
+#endif
+    }
+}
 
 F_Executor::F_Executor(const uint32_t workerThreadCount)
-    : ThreadResults{ std::make_unique<ExecutorThreadResult[]>(workerThreadCount) },
+    : ThreadResults{ std::make_unique<ExecutorThreadResult[]>(workerThreadCount + 1) },
       ThreadContexts{ std::make_unique<WorkerThreadContext[]>(workerThreadCount) },
       WorkerThreadCount{ workerThreadCount },
       multiThreadUpdateContext_{ nullptr },
@@ -18,13 +51,14 @@ F_Executor::F_Executor(const uint32_t workerThreadCount)
           [](const uint32_t)
           {
           }
-      }
+      },
+      activeWorkerThreadCount_{ workerThreadCount }
 {
-    for (int threadId = 1; threadId <= workerThreadCount; ++threadId)
+    for (uint32_t threadId = 1; threadId <= workerThreadCount; ++threadId)
     {
-        ThreadContexts[threadId - 1].WorkingFlag.store(true, std::memory_order_release);
+        ThreadContexts[threadId - 1].WorkerState.store(Working, std::memory_order_release);
         ThreadContexts[threadId - 1].Thread = std::thread(&F_Executor::WorkerThreadBody, this, threadId);
-        ThreadContexts[threadId - 1].WorkingFlag.wait(true, std::memory_order_acquire);
+        WaitUntilNotWorking(threadId);
     }
     F_Threads::GetSingleton().LockRegistration();
 }
@@ -41,10 +75,10 @@ F_Executor::~F_Executor()
     {
     };
 
-    for (int threadId = 1; threadId <= WorkerThreadCount; ++threadId)
+    for (uint32_t threadId = 1; threadId <= WorkerThreadCount; ++threadId)
     {
-        ThreadContexts[threadId - 1].WorkingFlag.store(true, std::memory_order_release);
-        ThreadContexts[threadId - 1].WorkingFlag.notify_one();
+        ThreadContexts[threadId - 1].WorkerState.store(Working, std::memory_order_release);
+        ThreadContexts[threadId - 1].WorkerState.notify_all();
         ThreadContexts[threadId - 1].Thread.join();
     }
 
@@ -53,25 +87,375 @@ F_Executor::~F_Executor()
 
 void F_Executor::WorkerThreadBody(const int threadId)
 {
-    UtilityFunctions::print("Worker Thread ", threadId, " start");
+    Log("Worker Thread ", threadId, " start");
     F_Threads::GetSingleton().RegisterCurrentThread(threadId);
 
+    auto& threadContext = ThreadContexts[threadId - 1];
     while (!shouldStop_.load(std::memory_order_relaxed))
     {
-        ThreadContexts[threadId - 1].WorkingFlag.wait(false, std::memory_order_acquire);
+        const auto workerState = threadContext.WorkerState.load(std::memory_order_acquire);
+        if (workerState == Idle)
+        {
+            threadContext.WorkerState.wait(Idle, std::memory_order_acquire);
+            continue;
+        }
+
         if (shouldStop_.load(std::memory_order_relaxed))
         {
             break;
         }
 
+        if (workerState == Background)
+        {
+            RunBackgroundJobs(threadId);
+            continue;
+        }
+
+        TaskDepth += 1;
         work_(threadId);
-        ThreadContexts[threadId - 1].WorkingFlag.store(false, std::memory_order_release);
-        ThreadContexts[threadId - 1].WorkingFlag.notify_one();
+        TaskDepth -= 1;
+        threadContext.WorkerState.store(Idle, std::memory_order_release);
+        threadContext.WorkerState.notify_all();
+
+        // 틱 사이의 남는 시간 동안 밀린 백그라운드 작업을 진행.
+        std::unique_lock lock{ backgroundJobsMutex_ };
+        if (!backgroundJobs_.empty())
+        {
+            lock.unlock();
+            auto expected = static_cast<uint8_t>(Idle);
+            threadContext.WorkerState.compare_exchange_strong(expected, Background, std::memory_order_acq_rel);
+        }
     }
 
-    UtilityFunctions::print("Worker Thread ", threadId, " end");
+    Log("Worker Thread ", threadId, " end");
 
-    ThreadContexts[threadId - 1].WorkingFlag.store(false, std::memory_order_release);
-    ThreadContexts[threadId - 1].WorkingFlag.notify_one();
+    threadContext.WorkerState.store(Idle, std::memory_order_release);
+    threadContext.WorkerState.notify_all();
     F_Threads::GetSingleton().UnregisterCurrentThread();
 }
+
+void F_Executor::Dispatch(const uint32_t workerThreadCount, const bool shouldCallerWork)
+{
+    for (uint32_t threadId = 1; threadId <= workerThreadCount; ++threadId)
+    {
+        ThreadResults[threadId].Clear();
+        ThreadContexts[threadId - 1].WorkerState.store(Working, std::memory_order_release);
+        ThreadContexts[threadId - 1].WorkerState.notify_all();
+    }
+
+    if (shouldCallerWork)
+    {
+        ThreadResults[F_Threads::MainThreadId].Clear();
+        TaskDepth += 1;
+        work_(F_Threads::MainThreadId);
+        TaskDepth -= 1;
+    }
+
+    for (uint32_t threadId = 1; threadId <= workerThreadCount; ++threadId)
+    {
+        WaitUntilNotWorking(threadId);
+    }
+}
+
+void F_Executor::WaitUntilNotWorking(const uint32_t threadId) const
+{
+    auto& workerState = ThreadContexts[threadId - 1].WorkerState;
+    while (workerState.load(std::memory_order_acquire) == Working)
+    {
+        workerState.wait(Working, std::memory_order_acquire);
+    }
+}
+
+void F_Executor::RunNestedJob(NestedJob& nestedJob)
+{
+    const auto threadId = F_Threads::GetCurrentThreadIdUnchecked();
+
+    // 청크가 하나뿐이면 다른 스레드가 도울 여지가 없으므로 목록에 올리지 않음.
+    const bool shouldShare = nestedJob.ElementCount > nestedJob.ChunkSize && WorkerThreadCount > 0;
+    if (shouldShare)
+    {
+        std::lock_guard lock{ nestedJobsMutex_ };
+        nestedJobs_.push_back(&nestedJob);
+        nestedJobCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ProcessNestedJobChunks(nestedJob, threadId);
+    if (!shouldShare)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard lock{ nestedJobsMutex_ };
+        std::erase(nestedJobs_, &nestedJob);
+        nestedJobCount_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // 도와준 스레드들이 가져간 청크를 마칠 때까지, 막혀 있지 않고 다른 중첩 작업을 도움.
+    while (nestedJob.RunningHelperCount.load(std::memory_order_acquire) > 0)
+    {
+        if (!HelpNestedJob(threadId))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool F_Executor::HelpNestedJob(const uint32_t threadId)
+{
+    NestedJob* nestedJob = nullptr;
+    {
+        std::lock_guard lock{ nestedJobsMutex_ };
+        for (const auto candidate : nestedJobs_)
+        {
+            if (!IsNestedJobExhausted(*candidate, candidate->Cursor.load(std::memory_order_relaxed))
+                && std::ranges::find(ProcessingNestedJobs, candidate) == ProcessingNestedJobs.end())
+            {
+                nestedJob = candidate;
+                nestedJob->RunningHelperCount.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+
+    if (!nestedJob)
+    {
+        return false;
+    }
+
+    ProcessNestedJobChunks(*nestedJob, threadId);
+    nestedJob->RunningHelperCount.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+bool F_Executor::IsNestedJobExhausted(const NestedJob& nestedJob, const uint32_t workBegin)
+{
+    return workBegin >= nestedJob.ElementCount
+           || (nestedJob.StopIndex && workBegin >= nestedJob.StopIndex->load(std::memory_order_relaxed));
+}
+
+void F_Executor::ProcessNestedJobChunks(NestedJob& nestedJob, const uint32_t threadId)
+{
+    TaskDepth += 1;
+    ProcessingNestedJobs.push_back(&nestedJob);
+    while (true)
+    {
+        const auto workBegin = nestedJob.Cursor.fetch_add(static_cast<uint32_t>(nestedJob.ChunkSize), std::memory_order_relaxed);
+        if (IsNestedJobExhausted(nestedJob, workBegin))
+        {
+            break;
+        }
+
+        const auto workEnd = static_cast<uint32_t>(std::min<size_t>(workBegin + nestedJob.ChunkSize, nestedJob.ElementCount));
+        nestedJob.ProcessRange(threadId, workBegin, workEnd);
+    }
+    ProcessingNestedJobs.pop_back();
+    TaskDepth -= 1;
+}
+
+void F_Executor::PushBackgroundJob(std::function<bool()> backgroundJob)
+{
+    {
+        std::lock_guard lock{ backgroundJobsMutex_ };
+        backgroundJobs_.push_back(std::move(backgroundJob));
+    }
+    if (WorkerThreadCount == 0)
+    {
+        RunBackgroundJobsOnCaller();
+        return;
+    }
+    WakeIdleWorkerForBackground();
+}
+
+void F_Executor::RunBackgroundJobsOnCaller()
+{
+    // 작업 안에서 등록된 작업(co_await로 멈춘 코루틴의 재개 등)은 재귀하지 않고 바깥 반복이 이어서 처리하므로,
+    // co_await가 반복되어도 스택이 쌓이지 않음.
+    if (IsRunningBackgroundJobsOnCaller)
+    {
+        return;
+    }
+
+    IsRunningBackgroundJobsOnCaller = true;
+    while (true)
+    {
+        std::function<bool()> backgroundJob;
+        {
+            std::lock_guard lock{ backgroundJobsMutex_ };
+            if (backgroundJobs_.empty())
+            {
+                break;
+            }
+
+            backgroundJob = std::move(backgroundJobs_.front());
+            backgroundJobs_.pop_front();
+        }
+
+        TaskDepth += 1;
+        while (!backgroundJob())
+        {
+        }
+        TaskDepth -= 1;
+    }
+    IsRunningBackgroundJobsOnCaller = false;
+}
+
+void F_Executor::Schedule(const std::coroutine_handle<> handle)
+{
+    PushBackgroundJob([handle]
+    {
+        handle.resume();
+        return true;
+    });
+}
+
+void F_Executor::WakeIdleWorkerForBackground()
+{
+    for (uint32_t threadId = 1; threadId <= WorkerThreadCount; ++threadId)
+    {
+        auto& workerState = ThreadContexts[threadId - 1].WorkerState;
+        auto expected = static_cast<uint8_t>(Idle);
+        if (workerState.compare_exchange_strong(expected, Background, std::memory_order_acq_rel))
+        {
+            workerState.notify_all();
+            return;
+        }
+    }
+}
+
+void F_Executor::RunBackgroundJobs(const uint32_t threadId)
+{
+    auto& workerState = ThreadContexts[threadId - 1].WorkerState;
+    while (true)
+    {
+        std::function<bool()> backgroundJob;
+        {
+            std::lock_guard lock{ backgroundJobsMutex_ };
+            if (backgroundJobs_.empty())
+            {
+                // 대기열을 비운 것을 확인한 후에만 Idle로 돌아가므로, 그 사이 등록된 작업은 등록한 쪽이 다른 워커를 깨움.
+                auto expected = static_cast<uint8_t>(Background);
+                workerState.compare_exchange_strong(expected, Idle, std::memory_order_acq_rel);
+                return;
+            }
+
+            backgroundJob = std::move(backgroundJobs_.front());
+            backgroundJobs_.pop_front();
+        }
+
+        // step 사이마다 Parallel For 요청이 들어왔는지 확인하고, 들어왔다면 작업을 되돌려 두고 양보함.
+        const auto runStep = [&backgroundJob]
+        {
+            TaskDepth += 1;
+            const auto isFinished = backgroundJob();
+            TaskDepth -= 1;
+            return isFinished;
+        };
+        while (!runStep())
+        {
+            if (workerState.load(std::memory_order_acquire) != Background)
+            {
+                std::lock_guard lock{ backgroundJobsMutex_ };
+                backgroundJobs_.push_front(std::move(backgroundJob));
+                return;
+            }
+        }
+
+        if (workerState.load(std::memory_order_acquire) != Background)
+        {
+            return;
+        }
+    }
+}
+
+void F_Executor::SetActiveWorkerThreadCount(const uint32_t activeWorkerThreadCount)
+{
+    activeWorkerThreadCount_ = std::clamp(activeWorkerThreadCount, std::min(WorkerThreadCount, 1u), WorkerThreadCount);
+}
+
+bool F_Executor::SetWorkerThreadAffinity(const std::span<const uint32_t> cpuIds)
+{
+    if (cpuIds.empty())
+    {
+        return false;
+    }
+
+    bool isAllPinned = true;
+    for (uint32_t threadId = 1; threadId <= WorkerThreadCount; ++threadId)
+    {
+        const auto cpuId = cpuIds[(threadId - 1) % cpuIds.size()];
+        auto& thread = ThreadContexts[threadId - 1].Thread;
+#if defined(_WIN32)
+        isAllPinned &= cpuId < 64
+            && SetThreadAffinityMask(thread.native_handle(), DWORD_PTR{ 1 } << cpuId) != 0;
+#elif defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpuId, &cpuSet);
+        isAllPinned &= pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+        static_cast<void>(cpuId);
+        static_cast<void>(thread);
+        isAllPinned = false;
+#endif
+    }
+    return isAllPinned;
+}
+
+std::vector<uint32_t> F_Executor::GetSmtAwareCpuOrder()
+{
+    const auto cpuCount = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<uint32_t> cpuOrder(cpuCount);
+    std::iota(cpuOrder.begin(), cpuOrder.end(), 0u);
+
+    // 각 논리 CPU가 속한 물리 코어 내에서 몇 번째 형제인지를 구해, (형제 순번, CPU 번호) 순으로 정렬.
+    std::vector<uint32_t> siblingIndices(cpuCount, 0);
+#if defined(_WIN32)
+    DWORD bufferSize = 0;
+    GetLogicalProcessorInformation(nullptr, &bufferSize);
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> processorInformations(
+        bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+    if (bufferSize == 0 || !GetLogicalProcessorInformation(processorInformations.data(), &bufferSize))
+    {
+        return cpuOrder;
+    }
+
+    for (const auto& processorInformation : processorInformations)
+    {
+        if (processorInformation.Relationship != RelationProcessorCore)
+        {
+            continue;
+        }
+
+        uint32_t siblingIndex = 0;
+        for (uint32_t cpuId = 0; cpuId < std::min(cpuCount, 64u); ++cpuId)
+        {
+            if (processorInformation.ProcessorMask & (ULONG_PTR{ 1 } << cpuId))
+            {
+                siblingIndices[cpuId] = siblingIndex++;
+            }
+        }
+    }
+#elif defined(__linux__)
+    for (uint32_t cpuId = 0; cpuId < cpuCount; ++cpuId)
+    {
+        // 예: "2,10" 또는 "2-3". 첫 번째 값이 이 코어의 대표 CPU이며, 자신이 대표가 아니면 SMT 형제로 봄.
+        std::ifstream siblingsFile{ "/sys/devices/system/cpu/cpu" + std::to_string(cpuId) + "/topology/thread_siblings_list" };
+        uint32_t firstSiblingCpuId = cpuId;
+        if (!(siblingsFile >> firstSiblingCpuId))
+        {
+            return cpuOrder;
+        }
+        siblingIndices[cpuId] = firstSiblingCpuId == cpuId ? 0 : 1;
+    }
+#else
+    return cpuOrder;
+#endif
+
+    std::ranges::stable_sort(cpuOrder,
+                             [&siblingIndices](const uint32_t lhs, const uint32_t rhs)
+                             {
+                                 return siblingIndices[lhs] < siblingIndices[rhs];
+                             });
+    return cpuOrder;
+}
@@ -7,10 +7,20 @@
 
 #include "F_EntityManager.h"
 #include "U_Concurrency.h"
+#include "U_ErrorMacros.h"
 #include "F_System.h"
+#include "F_Task.h"
+#include <algorithm>
+#include <coroutine>
+#include <deque>
 #include <functional>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include <span>
 #include <optional>
+#include <vector>
 
 namespace Core
 {
@@ -46,6 +56,21 @@ namespace Core
         { std::invoke(task, immutableContext) } -> std::same_as<std::optional<TExecutionResult>>;
     };
 
+    template<typename TComponent, typename Task>
+    concept IsParallelSearchTask = requires(Task task,
+                                            F_Entity entity,
+                                            const TComponent& component,
+                                            const F_ImmutableContext& immutableContext)
+    {
+        { std::invoke(task, entity, component, immutableContext) } -> std::same_as<bool>;
+    };
+
+    template<typename TResult, typename Step>
+    concept IsBackgroundJobStep = requires(Step step)
+    {
+        { std::invoke(step) } -> std::same_as<std::optional<TResult>>;
+    };
+
     class alignas(U_Concurrency::CacheLineSize) F_Executor final
     {
         struct ExecutorThreadResult;
@@ -59,6 +84,11 @@ namespace Core
         template<typename TResult>
         class ExecutionResults;
 
+        class ScheduleAwaiter;
+
+        template<typename TResult, typename TStep>
+        class BackgroundJobAwaiter;
+
         explicit F_Executor(uint32_t workerThreadCount);
 
         ~F_Executor();
@@ -71,12 +101,21 @@ namespace Core
 
         F_Executor& operator=(F_Executor&&) = delete;
 
+        /**
+         * 요소 수를 미리 알고 분배하므로, 요소가 chunkSize개 이하이면 워커를 깨우지 않고 호출한 스레드에서 바로 처리하며,
+         * 그보다 많으면 호출한 스레드도 청크를 처리하며 나머지 청크 수만큼의 워커만 깨움. 워커가 없는 F_Executor에서는 모든 요소를 호출한 스레드에서 처리함. ParallelForEvents()도 동일.
+         * Parallel For의 task나 백그라운드 작업 안에서 다시 호출하면(중첩 호출), 워커들을 새로 깨우지 않고 작업을 공유 목록에 올린 후
+         * 호출한 스레드가 직접 처리하면서 청크 사이마다 확인하는 다른 워커들의 도움을 받음. 이 때의 결과는 같은 스레드의 같은 깊이에서
+         * 다음 중첩 호출이 있기 전까지 유효함.
+         * @remarks 분배할 범위를 미리 알기 위해 F_EntityManager::GetComponentCount<T>()와 F_EventManager::GetEventCount<T>()를
+         * 사용함. 이 저장소 밖의 엔진 코드에 두 함수가 있어야 하며, Shim/에는 독립 빌드를 위한 구현이 있음.
+         */
         template<IsComponent TComponent,
             IsTriviallyCopyable TExecutionResult,
             E_Execution Execution = E_Execution::TotallyImmutable>
         ExecutionResults<TExecutionResult> ParallelForComponents(const F_MutableContext& context,
                                                                  auto&& task,
-                                                                 size_t chunkSize)
+                                                                 size_t chunkSize = 32)
             requires IsParallelForComponentsTask<TComponent, TExecutionResult, decltype(task), Execution>;
 
         template<IsEvent TEvent,
@@ -84,30 +123,203 @@ namespace Core
             E_Execution Execution = E_Execution::TotallyImmutable>
         ExecutionResults<TExecutionResult> ParallelForEvents(const F_MutableContext& context,
                                                              auto&& task,
-                                                             size_t chunkSize)
+                                                             size_t chunkSize = 32)
             requires IsParallelForEventsTask<TEvent, TExecutionResult, decltype(task), Execution>;
 
+        /**
+         * 모든 워커에서 task를 한 번씩 실행. 스레드별 작업을 위한 것이므로 중첩 호출할 수 없음.
+         */
         template<IsTriviallyCopyable TExecutionResult>
         ExecutionResults<TExecutionResult> ParallelForWorkerThreads(const F_MutableContext& context, auto&& task)
             requires IsParallelForWorkerThreadsTask<TExecutionResult, decltype(task)>;
 
+        /**
+         * predicate를 만족하는 컴포넌트 중 dense Index가 가장 작은 것의 엔티티를 찾음. 어느 청크에서든 찾으면, 그보다 뒤에서 시작하는
+         * 청크들은 더 이상 가져가지 않으므로 앞쪽에서 찾을수록 빨리 끝남. 이미 처리 중인 앞쪽 청크들은 끝까지 확인함.
+         */
+        template<IsComponent TComponent>
+        std::optional<F_Entity> ParallelFindFirst(const F_MutableContext& context, auto&& predicate, size_t chunkSize = 32)
+            requires IsParallelSearchTask<TComponent, decltype(predicate)>;
+
+        /**
+         * predicate를 만족하는 컴포넌트가 하나라도 있는지 확인. 어느 것이든 찾는 즉시 모든 스레드가 다음 청크를 가져가지 않고 멈춤.
+         */
+        template<IsComponent TComponent>
+        bool ParallelAnyOf(const F_MutableContext& context, auto&& predicate, size_t chunkSize = 32)
+            requires IsParallelSearchTask<TComponent, decltype(predicate)>;
+
+        /**
+         * values를 블록으로 나누어 워커들이 각자 정렬한 후, 인접한 블록 쌍들을 병렬로 병합하는 과정을 반복함. 안정 정렬이 아님.
+         * 병합용 임시 공간은 호출한 스레드의 페이지를 재사용함.
+         */
+        template<IsTriviallyCopyable T, typename TCompare = std::less<>>
+        void ParallelSort(const F_MutableContext& context, std::span<T> values, TCompare compare = {});
+
+        /**
+         * values[i] = values[0] op ... op values[i]로 제자리 변환. op는 결합 법칙을 만족해야 함.
+         */
+        template<IsTriviallyCopyable T, typename TOperation = std::plus<>>
+        void ParallelInclusiveScan(const F_MutableContext& context, std::span<T> values, TOperation operation = {});
+
+        /**
+         * predicate를 만족하는 input의 원소들을 순서를 유지하여 output 앞쪽에 복사. predicate는 원소마다 두 번 호출될 수 있음.
+         * @return 복사된 원소 수.
+         */
+        template<IsTriviallyCopyable T>
+        size_t ParallelCopyIf(const F_MutableContext& context, std::span<const T> input, std::span<T> output, auto&& predicate);
+
+        /**
+         * predicate를 만족하는 원소들을 앞으로, 나머지를 뒤로 옮기며 각 그룹 내의 순서는 유지함(안정 분할). predicate는 원소마다 두 번 호출될 수 있음.
+         * @return 만족하는 원소의 수(분할 지점).
+         */
+        template<IsTriviallyCopyable T>
+        size_t ParallelPartition(const F_MutableContext& context, std::span<T> values, auto&& predicate);
+
+        /**
+         * blockTask(blockIndex)를 [0, blockCount)에 대해 병렬로 실행. 블록 하나가 청크 하나이므로 블록은 충분히 크게 나눌 것.
+         * 병렬 알고리즘들과 ParallelExecutorTiles.h의 ParallelForTiles()처럼 작업을 직접 블록으로 나누는 경우를 위한 것.
+         */
+        void ForEachBlock(const F_MutableContext& context, size_t blockCount, auto&& blockTask);
+
+        /**
+         * 틱과 무관하게 쉬고 있는 워커가 조금씩 진행하는 백그라운드 작업을 등록. 어느 스레드에서든 호출 가능.
+         * step은 값을 반환할 때까지 반복 호출되며, 호출과 호출 사이에 Parallel For 요청이 들어오면 워커는 즉시 그쪽으로 넘어가고
+         * 작업은 대기열 맨 앞으로 돌아가 이후 이어서 진행됨. 따라서 step 한 번은 짧게(청크 하나 정도) 유지할 것.
+         * @tparam TResult
+         * @param step std::optional<TResult>()를 만족하는 호출 가능 객체. 아직 끝나지 않았으면 std::nullopt 반환.
+         * @remarks 워커가 없는 F_Executor에서는 호출한 스레드에서 끝날 때까지 바로 실행하므로, 반환된 future는 이미 준비되어 있음.
+         */
+        template<typename TResult>
+        std::future<TResult> SubmitBackgroundJob(auto&& step)
+            requires IsBackgroundJobStep<TResult, decltype(step)>;
+
+        /**
+         * task를 쉬고 있는 워커에서 백그라운드 작업으로 시작. task가 co_await로 멈추면 그 워커는 다른 작업으로 넘어가고,
+         * 기다리던 일이 끝나면 그 일을 마친 워커가 이어서 재개함. 코루틴 본문에서 ParallelFor를 직접 호출하면 중첩 호출로 처리됨.
+         * @remarks 재개될 때마다 다른 스레드일 수 있으므로, 중첩 호출의 결과나 thread_local 상태를 co_await 너머로 들고 가지 말 것.
+         * 워커가 없는 F_Executor에서는 호출한 스레드에서 바로 시작하며, co_await로 멈추면 기다리던 일을 끝낸 스레드에서 재개됨.
+         */
+        template<typename TResult>
+        std::future<TResult> Spawn(F_Task<TResult> task);
+
+        /**
+         * 현재 코루틴을 대기열 맨 뒤로 보내 다른 작업에 워커를 양보한 후, 쉬고 있는 워커에서 재개.
+         */
+        [[nodiscard]]
+        ScheduleAwaiter Yield();
+
+        /**
+         * 멈춰 있는 코루틴을 백그라운드 작업으로 등록하여 쉬고 있는 워커가 재개하도록 함.
+         * 다른 시스템이 자신의 일을 끝낸 시점에 코루틴을 재개하는 Awaiter를 만들 때 사용. 어느 스레드에서든 호출 가능.
+         * 워커가 없는 F_Executor에서는 호출한 스레드에서 바로 재개함.
+         */
+        void Schedule(std::coroutine_handle<> handle);
+
+        /**
+         * step을 백그라운드 작업으로 실행하고, 값을 반환하면 그 워커에서 곧바로 현재 코루틴을 재개하여 그 값을 돌려줌.
+         * 기다리는 동안 코루틴은 어떤 스레드도 점유하지 않음.
+         */
+        template<typename TResult>
+        [[nodiscard]]
+        auto AwaitBackgroundJob(auto&& step)
+            requires IsBackgroundJobStep<TResult, decltype(step)>;
+
+        /**
+         * ParallelForComponents(), ParallelForEvents()에서 깨울 워커 수를 변경. 나머지 워커는 대기하거나 백그라운드 작업을 계속 진행함.
+         * 틱 사이에 메인 스레드에서 호출할 것. ParallelForWorkerThreads()는 스레드별 작업을 위한 것이므로 항상 모든 워커를 깨움.
+         * @param activeWorkerThreadCount 1 이상 생성 시 지정한 워커 수 이하로 조정됨.
+         */
+        void SetActiveWorkerThreadCount(uint32_t activeWorkerThreadCount);
+
+        [[nodiscard]]
+        uint32_t GetActiveWorkerThreadCount() const
+        {
+            return activeWorkerThreadCount_;
+        }
+
+        /**
+         * ThreadId가 n인 워커를 cpuIds[(n - 1) % cpuIds.size()]번 논리 CPU에 고정함.
+         * @return 지원하지 않는 플랫폼이거나 하나라도 실패하면 false.
+         */
+        bool SetWorkerThreadAffinity(std::span<const uint32_t> cpuIds);
+
+        /**
+         * 물리 코어마다 첫 번째 논리 CPU를 먼저 나열하고, 그 다음에 나머지 SMT 형제들을 나열한 순서.
+         * 0번 원소는 메인 스레드용으로 두고 나머지를 SetWorkerThreadAffinity()에 넘기면, 워커가 물리 코어를 하나씩 먼저 차지함.
+         * 토폴로지를 알 수 없으면 0부터 순서대로 반환.
+         */
+        [[nodiscard]]
+        static std::vector<uint32_t> GetSmtAwareCpuOrder();
+
     private:
-        struct WorkerThreadContext
+        /**
+         * Idle -> Working: 메인 스레드가 Parallel For 작업을 맡김. 백그라운드 작업 중이어도 덮어씀.
+         * Working -> Idle: 워커가 작업을 마침. 메인 스레드는 Working이 아니게 될 때까지 대기함.
+         * Idle -> Background: 백그라운드 작업이 등록되어 쉬고 있는 워커를 깨움. Working은 덮어쓰지 않음(CAS).
+         */
+        enum E_WorkerState : uint8_t
+        {
+            Idle,
+            Working,
+            Background,
+        };
+
+        struct alignas(U_Concurrency::CacheLineSize) WorkerThreadContext
         {
             std::thread Thread;
-            std::atomic_bool WorkingFlag;
+            std::atomic_uint8_t WorkerState;
         };
 
         static constexpr size_t BaseThreadMemorySize = 1024;
 
-        const std::unique_ptr<ExecutorThreadResult[]> ThreadResults;
+        const std::unique_ptr<ExecutorThreadResult[]> ThreadResults; // [0]은 호출한 스레드, [ThreadId]는 각 워커의 결과 페이지.
         const std::unique_ptr<WorkerThreadContext[]> ThreadContexts;
         const uint32_t WorkerThreadCount;
 
         const F_MutableContext* multiThreadUpdateContext_;
         std::function<void(uint32_t)> work_;
+        uint32_t activeWorkerThreadCount_;
         alignas(U_Concurrency::CacheLineSize) std::atomic_bool shouldStop_; // 메인 스레드에서 설정하는, 워커 스레드들의 완전한 종료 명령 상태.
 
+        /**
+         * 중첩 호출로 생긴 작업. 호출한 스레드의 스택에 있으며, 목록에서 제거되고 RunningHelperCount가 0이 될 때까지 유효함.
+         */
+        struct NestedJob
+        {
+            std::function<void(uint32_t threadId, uint32_t workBegin, uint32_t workEnd)> ProcessRange;
+            size_t ElementCount;
+            size_t ChunkSize;
+            std::atomic_uint32_t Cursor;
+            std::atomic_uint32_t RunningHelperCount;
+            const std::atomic_uint32_t* StopIndex; // nullptr가 아니면, 이 값 이상에서 시작하는 청크는 가져가지 않음.
+        };
+
+        // 현재 스레드가 실행 중인 task의 깊이. 0이면 task 밖이므로 워커들을 깨우는 일반적인 호출임.
+        inline static thread_local uint32_t TaskDepth = 0;
+
+        // 워커가 없을 때 현재 스레드가 백그라운드 작업들을 직접 처리하는 중이면 true.
+        inline static thread_local bool IsRunningBackgroundJobsOnCaller = false;
+
+        // 중첩 호출의 결과 페이지. [깊이 - 1][ThreadId]. 호출한 스레드와 깊이마다 따로 두므로 서로 덮어쓰지 않음.
+        inline static thread_local std::vector<std::unique_ptr<ExecutorThreadResult[]>> NestedThreadResults;
+
+        // 병렬 알고리즘들의 임시 공간. 호출한 스레드마다 따로 두므로 task 안에서 호출해도 안전함.
+        static constexpr size_t MinPrimitiveBlockSize = 4096;
+        static thread_local ExecutorThreadResult PrimitiveElementScratch;
+        static thread_local ExecutorThreadResult PrimitiveBlockScratch;
+
+        // 현재 스레드가 청크를 처리하는 중인 중첩 작업들. 처리 중인 청크의 task 안에서 같은 작업을 다시 돕게 되면
+        // 한 청크의 결과가 다른 청크의 결과 사이에 끼어들어 구간이 깨지므로, 이 작업들은 돕지 않음.
+        inline static thread_local std::vector<NestedJob*> ProcessingNestedJobs;
+
+        std::mutex nestedJobsMutex_;
+        std::vector<NestedJob*> nestedJobs_;
+        alignas(U_Concurrency::CacheLineSize) std::atomic_uint32_t nestedJobCount_; // 워커들이 청크 사이마다 잠금 없이 확인하기 위한 값.
+
+        // 완료되면 true를 반환하는 백그라운드 작업의 step들.
+        std::mutex backgroundJobsMutex_;
+        std::deque<std::function<bool()>> backgroundJobs_;
+
         // Component인 경우 dense Index, Event인 경우 EventQueue에서의 Index.
         alignas(U_Concurrency::CacheLineSize) std::atomic_uint32_t multiThreadWorkIndex_;
 
@@ -115,20 +327,125 @@ namespace Core
 
         static void ExtendPageAtLeast(ExecutorThreadResult& threadResult, size_t atLeast);
 
+        /**
+         * work_가 설정된 상태에서 1 ~ workerThreadCount번 워커를 깨워 실행시키고, 모두 끝날 때까지 대기.
+         * @param shouldCallerWork true이면 기다리기 전에 호출한 스레드도 work_(MainThreadId)를 실행함.
+         */
+        void Dispatch(uint32_t workerThreadCount, bool shouldCallerWork);
+
+        void WaitUntilNotWorking(uint32_t threadId) const;
+
+        /**
+         * nestedJob을 목록에 올리고 호출한 스레드에서 직접 처리한 후, 도와준 스레드들이 끝날 때까지 다른 중첩 작업을 도우며 대기.
+         */
+        void RunNestedJob(NestedJob& nestedJob);
+
+        /**
+         * 남은 청크가 있는 중첩 작업 하나를 찾아 청크가 바닥날 때까지 처리.
+         * @return 도운 작업이 있었다면 true.
+         */
+        bool HelpNestedJob(uint32_t threadId);
+
+        static void ProcessNestedJobChunks(NestedJob& nestedJob, uint32_t threadId);
+
+        [[nodiscard]]
+        static bool IsNestedJobExhausted(const NestedJob& nestedJob, uint32_t workBegin);
+
+        /**
+         * [0, elementCount)를 chunkSize 단위로 나누어 processRange(결과 페이지, 시작, 끝)를 실행.
+         * 중첩 호출이면 중첩 경로로, 청크가 하나뿐이면 호출한 스레드에서, 그 외에는 워커들을 깨워 처리함.
+         * @param stopIndex nullptr가 아니면 청크를 가져갈 때마다 확인하여, 이 값 이상에서 시작하는 청크는 처리하지 않고 끝냄.
+         * @return 결과가 기록된 페이지들.
+         */
+        std::span<ExecutorThreadResult> DispatchRanges(const F_MutableContext& context,
+                                                       size_t chunkSize,
+                                                       size_t elementCount,
+                                                       auto&& processRange,
+                                                       const std::atomic_uint32_t* stopIndex = nullptr);
+
+        std::span<ExecutorThreadResult> DispatchNestedRanges(size_t chunkSize,
+                                                             size_t elementCount,
+                                                             auto&& processRange,
+                                                             const std::atomic_uint32_t* stopIndex);
+
+        /**
+         * predicate를 만족하는 dense Index를 찾으면 stopIndex를 갱신함. lowestIndexWins이면 찾은 것 중 가장 작은 값으로,
+         * 아니면 0으로 바꾸어 모든 스레드가 즉시 멈추도록 함.
+         * @return 찾지 못했으면 std::numeric_limits<uint32_t>::max().
+         */
+        template<IsComponent TComponent>
+        uint32_t ParallelSearchCommon(const F_MutableContext& context,
+                                      auto&& predicate,
+                                      size_t chunkSize,
+                                      bool lowestIndexWins);
+
+        [[nodiscard]]
+        size_t GetPrimitiveBlockCount(const size_t elementCount) const
+        {
+            return std::clamp<size_t>(elementCount / MinPrimitiveBlockSize, 1, (activeWorkerThreadCount_ + 1) * 2);
+        }
+
+        [[nodiscard]]
+        static size_t GetPrimitiveBlockBegin(const size_t elementCount, const size_t blockCount, const size_t blockIndex)
+        {
+            return elementCount * blockIndex / blockCount;
+        }
+
+        template<IsTriviallyCopyable T>
+        static T* GetScratch(ExecutorThreadResult& scratch, size_t count);
+
+        void PushBackgroundJob(std::function<bool()> backgroundJob);
+
+        void RunBackgroundJobsOnCaller();
+
+        template<typename TResult>
+        static F_DetachedTask RunSpawnedTask(F_Task<TResult> task, std::shared_ptr<std::promise<TResult>> promise);
+
+        /**
+         * 쉬고 있는 워커가 있다면 하나를 Background 상태로 깨움.
+         */
+        void WakeIdleWorkerForBackground();
+
+        /**
+         * WorkerState가 Background인 동안 백그라운드 작업을 진행. 대기열이 비면 Idle로 돌아감.
+         */
+        void RunBackgroundJobs(uint32_t threadId);
+
         template<IsTriviallyCopyable TExecutionResult>
         ExecutionResults<TExecutionResult> ExecutorCommon(const F_MutableContext& context,
                                                           size_t chunkSize,
+                                                          size_t elementCount,
                                                           auto&& getAxis,
                                                           auto&& task);
     };
 
     struct F_Executor::ExecutorThreadResult final
     {
+        /**
+         * 한 청크에서 나온 결과들의 시작 위치. 청크의 첫 요소 Index로 태그하여, Index 순서로 순회할 때 사용.
+         */
+        struct ResultSegment final
+        {
+            uint32_t ElementBegin;
+            uint32_t ResultBegin;
+        };
+
         size_t MemoryBlockSize = 0;
         size_t ResultElementCount = 0;
         std::unique_ptr<char[]> MemoryBlock;
+        std::vector<ResultSegment> Segments; // 청크를 가져간 순서이므로 ElementBegin 오름차순.
+        uint32_t OrderedSegmentCursor = 0; // Index 순서 순회 중 다음에 볼 Segments의 위치.
+
+        void Clear()
+        {
+            ResultElementCount = 0;
+            Segments.clear();
+        }
     };
 
+    inline thread_local F_Executor::ExecutorThreadResult F_Executor::PrimitiveElementScratch;
+    inline thread_local F_Executor::ExecutorThreadResult F_Executor::PrimitiveBlockScratch;
+
     template<typename TResult>
     class F_Executor::ExecutionResults final
     {
@@ -228,10 +545,200 @@ namespace Core
             return Iterator{ threadContexts_, static_cast<uint32_t>(threadContexts_.size()), 0 };
         }
 
+        /**
+         * 스레드별이 아닌 요소의 Index(컴포넌트는 dense Index, 이벤트는 EventQueue에서의 Index) 순서로 순회하는 반복자.
+         * 각 스레드의 구간들은 이미 Index 오름차순이므로, 스레드들의 다음 구간 중 가장 앞선 것을 고르는 k-way 병합으로 진행함.
+         */
+        class OrderedIterator final
+        {
+        public:
+            using value_type = TResult;
+            using reference = const value_type&;
+            using iterator_category = std::input_iterator_tag;
+
+            explicit OrderedIterator(const std::span<ExecutorThreadResult> threadResults)
+                : threadResults_{ threadResults },
+                  currentThreadResultIndex_{ static_cast<uint32_t>(threadResults.size()) },
+                  currentResultElementIndex_{ 0 },
+                  currentSegmentEnd_{ 0 }
+            {
+            }
+
+            reference operator*() const
+            {
+                return *reinterpret_cast<value_type*>(
+                    threadResults_[currentThreadResultIndex_].MemoryBlock.get() + currentResultElementIndex_ * sizeof(
+                        TResult));
+            }
+
+            OrderedIterator& operator++()
+            {
+                currentResultElementIndex_ += 1;
+                if (currentResultElementIndex_ >= currentSegmentEnd_)
+                {
+                    MoveToNextSegment();
+                }
+
+                return *this;
+            }
+
+            bool operator==(const OrderedIterator&) const
+            {
+                return currentThreadResultIndex_ >= threadResults_.size();
+            }
+
+            bool operator!=(const OrderedIterator&) const
+            {
+                return currentThreadResultIndex_ < threadResults_.size();
+            }
+
+            void MoveToNextSegment()
+            {
+                auto nextThreadResultIndex = static_cast<uint32_t>(threadResults_.size());
+                auto nextElementBegin = std::numeric_limits<uint32_t>::max();
+                for (uint32_t threadResultIndex = 0; threadResultIndex < threadResults_.size(); ++threadResultIndex)
+                {
+                    const auto& threadResult = threadResults_[threadResultIndex];
+                    if (threadResult.OrderedSegmentCursor < threadResult.Segments.size()
+                        && threadResult.Segments[threadResult.OrderedSegmentCursor].ElementBegin < nextElementBegin)
+                    {
+                        nextThreadResultIndex = threadResultIndex;
+                        nextElementBegin = threadResult.Segments[threadResult.OrderedSegmentCursor].ElementBegin;
+                    }
+                }
+
+                currentThreadResultIndex_ = nextThreadResultIndex;
+                if (nextThreadResultIndex >= threadResults_.size())
+                {
+                    return;
+                }
+
+                auto& threadResult = threadResults_[nextThreadResultIndex];
+                const auto segmentIndex = threadResult.OrderedSegmentCursor++;
+                currentResultElementIndex_ = threadResult.Segments[segmentIndex].ResultBegin;
+                currentSegmentEnd_ = segmentIndex + 1 < threadResult.Segments.size()
+                                         ? threadResult.Segments[segmentIndex + 1].ResultBegin
+                                         : static_cast<uint32_t>(threadResult.ResultElementCount);
+            }
+
+        private:
+            std::span<ExecutorThreadResult> threadResults_;
+            uint32_t currentThreadResultIndex_;
+            uint32_t currentResultElementIndex_;
+            uint32_t currentSegmentEnd_;
+        };
+
+        class OrderedView final
+        {
+        public:
+            explicit OrderedView(const std::span<ExecutorThreadResult> threadResults)
+                : threadResults_{ threadResults }
+            {
+            }
+
+            OrderedIterator begin() const
+            {
+                for (auto& threadResult : threadResults_)
+                {
+                    threadResult.OrderedSegmentCursor = 0;
+                }
+
+                auto iterator = OrderedIterator{ threadResults_ };
+                iterator.MoveToNextSegment();
+                return iterator;
+            }
+
+            OrderedIterator end() const
+            {
+                return OrderedIterator{ threadResults_ };
+            }
+
+        private:
+            std::span<ExecutorThreadResult> threadResults_;
+        };
+
+        /**
+         * 결과를 어느 스레드가 처리했는지와 무관하게 항상 요소의 Index 순서로 순회. 락스텝, 리플레이처럼 결정적인 순서가 필요한 경우 사용.
+         * 청크마다 남긴 구간을 병합하므로 정렬 비용이 없음. ParallelForWorkerThreads()의 결과는 워커 번호 순서.
+         * @remarks 순회 상태를 결과 페이지에 기록하므로, 같은 결과를 동시에 여러 번 순회하지 말 것.
+         */
+        OrderedView GetOrdered() const
+        {
+            return OrderedView{ threadContexts_ };
+        }
+
     private:
         std::span<ExecutorThreadResult> threadContexts_;
     };
 
+    class F_Executor::ScheduleAwaiter final
+    {
+    public:
+        explicit ScheduleAwaiter(F_Executor& executor)
+            : executor_{ executor }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> handle) const
+        {
+            executor_.Schedule(handle);
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        F_Executor& executor_;
+    };
+
+    template<typename TResult, typename TStep>
+    class F_Executor::BackgroundJobAwaiter final
+    {
+    public:
+        BackgroundJobAwaiter(F_Executor& executor, TStep step)
+            : executor_{ executor },
+              step_{ std::move(step) }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> handle)
+        {
+            // 재개된 코루틴이 이 awaiter를 파괴할 수 있으므로, resume() 이후에는 this를 건드리지 않음.
+            executor_.PushBackgroundJob([this, handle]
+            {
+                result_ = step_();
+                if (!result_)
+                {
+                    return false;
+                }
+
+                handle.resume();
+                return true;
+            });
+        }
+
+        TResult await_resume()
+        {
+            return std::move(*result_);
+        }
+
+    private:
+        F_Executor& executor_;
+        TStep step_;
+        std::optional<TResult> result_;
+    };
+
     struct F_Executor::WorkerParameters
     {
         const F_MutableContext& Mutable;
@@ -245,12 +752,13 @@ namespace Core
     F_Executor::ExecutionResults<TExecutionResult> F_Executor::ParallelForComponents(
         const F_MutableContext& context,
         auto&& task,
-        const size_t chunkSize = 32)
+        const size_t chunkSize)
         requires IsParallelForComponentsTask<TComponent, TExecutionResult, decltype(task), Execution>
     {
         return ExecutorCommon<TExecutionResult>(
             context,
             chunkSize,
+            context.EntityManager.template GetComponentCount<TComponent>(),
             [](const WorkerParameters& workerParameters, const uint32_t index)
             {
                 if constexpr (Execution == E_Execution::TotallyImmutable)
@@ -276,12 +784,13 @@ namespace Core
     F_Executor::ExecutionResults<TExecutionResult> F_Executor::ParallelForEvents(
         const F_MutableContext& context,
         auto&& task,
-        const size_t chunkSize = 32)
+        const size_t chunkSize)
         requires IsParallelForEventsTask<TEvent, TExecutionResult, decltype(task), Execution>
     {
         return ExecutorCommon<TExecutionResult>(
             context,
             chunkSize,
+            context.EventManager.template GetEventCount<TEvent>(),
             [](const WorkerParameters& workerParameters,
                const uint32_t index) -> std::pair<int, std::conditional_t<Execution == E_Execution::TotallyImmutable,
             const TEvent*, TEvent*>>
@@ -305,9 +814,11 @@ namespace Core
     ParallelForWorkerThreads(const F_MutableContext& context, auto&& task)
     requires IsParallelForWorkerThreadsTask<TExecutionResult, decltype(task)>
     {
+        SCRASH_COND(TaskDepth > 0);
+
         work_ = [this, &context, &task](const uint32_t threadId)
         {
-            auto& threadResult = ThreadResults[threadId - 1];
+            auto& threadResult = ThreadResults[threadId];
             const auto result = task(static_cast<F_ImmutableContext>(context));
             if (!result)
             {
@@ -315,28 +826,396 @@ namespace Core
             }
 
             ExtendPageAtLeast(threadResult, sizeof(TExecutionResult));
-            memcpy(
-                threadResult.MemoryBlock.get() + sizeof(TExecutionResult),
-                &*result,
-                sizeof(TExecutionResult));
+            memcpy(threadResult.MemoryBlock.get(), &*result, sizeof(TExecutionResult));
             threadResult.ResultElementCount = 1;
+            threadResult.Segments.push_back({ threadId, 0 });
         };
 
         multiThreadUpdateContext_ = &context;
         multiThreadWorkIndex_.store(0, std::memory_order_relaxed);
+        Dispatch(WorkerThreadCount, false);
+
+        return ExecutionResults<TExecutionResult>{ std::span{ ThreadResults.get() + 1, WorkerThreadCount } };
+    }
 
-        for (int threadId = 1; threadId <= WorkerThreadCount; ++threadId)
+    template<IsComponent TComponent>
+    std::optional<F_Entity> F_Executor::ParallelFindFirst(const F_MutableContext& context,
+                                                          auto&& predicate,
+                                                          const size_t chunkSize)
+        requires IsParallelSearchTask<TComponent, decltype(predicate)>
+    {
+        const auto foundIndex = ParallelSearchCommon<TComponent>(context, predicate, chunkSize, true);
+        if (foundIndex == std::numeric_limits<uint32_t>::max())
         {
-            ThreadResults[threadId - 1].ResultElementCount = 0;
-            ThreadContexts[threadId - 1].WorkingFlag.store(true, std::memory_order_release);
-            ThreadContexts[threadId - 1].WorkingFlag.notify_one();
+            return std::nullopt;
         }
-        for (int threadId = 1; threadId <= WorkerThreadCount; ++threadId)
+
+        return context.EntityManager.template GetComponentFromDenseIndex<TComponent>(foundIndex).first;
+    }
+
+    template<IsComponent TComponent>
+    bool F_Executor::ParallelAnyOf(const F_MutableContext& context, auto&& predicate, const size_t chunkSize)
+        requires IsParallelSearchTask<TComponent, decltype(predicate)>
+    {
+        return ParallelSearchCommon<TComponent>(context, predicate, chunkSize, false) != std::numeric_limits<uint32_t>::max();
+    }
+
+    template<IsComponent TComponent>
+    uint32_t F_Executor::ParallelSearchCommon(const F_MutableContext& context,
+                                              auto&& predicate,
+                                              const size_t chunkSize,
+                                              const bool lowestIndexWins)
+    {
+        const auto immutableContext = static_cast<F_ImmutableContext>(context);
+        std::atomic_uint32_t stopIndex = std::numeric_limits<uint32_t>::max();
+        std::atomic_bool isFound = false;
+
+        const auto processRange = [&immutableContext, &predicate, &stopIndex, &isFound, lowestIndexWins](
+            ExecutorThreadResult&,
+            const uint32_t workBegin,
+            const uint32_t workEnd)
+        {
+            for (uint32_t i = workBegin; i < workEnd; ++i)
+            {
+                const auto [entity, component] = immutableContext.EntityManager.template GetComponentFromDenseIndex<TComponent>(i);
+                if (!component || !predicate(entity, *component, immutableContext))
+                {
+                    continue;
+                }
+
+                isFound.store(true, std::memory_order_relaxed);
+                if (!lowestIndexWins)
+                {
+                    stopIndex.store(0, std::memory_order_relaxed);
+                    return;
+                }
+
+                auto currentStopIndex = stopIndex.load(std::memory_order_relaxed);
+                while (i < currentStopIndex
+                       && !stopIndex.compare_exchange_weak(currentStopIndex, i, std::memory_order_relaxed))
+                {
+                }
+                return;
+            }
+        };
+
+        DispatchRanges(context, chunkSize, context.EntityManager.template GetComponentCount<TComponent>(), processRange, &stopIndex);
+
+        // 워커들의 종료를 기다리며 동기화되었으므로 relaxed로 충분함.
+        if (!isFound.load(std::memory_order_relaxed))
+        {
+            return std::numeric_limits<uint32_t>::max();
+        }
+
+        return lowestIndexWins ? stopIndex.load(std::memory_order_relaxed) : 0;
+    }
+
+    template<IsTriviallyCopyable T>
+    T* F_Executor::GetScratch(ExecutorThreadResult& scratch, const size_t count)
+    {
+        ExtendPageAtLeast(scratch, sizeof(T) * count);
+        return reinterpret_cast<T*>(scratch.MemoryBlock.get());
+    }
+
+    void F_Executor::ForEachBlock(const F_MutableContext& context, const size_t blockCount, auto&& blockTask)
+    {
+        DispatchRanges(context,
+                       1,
+                       blockCount,
+                       [&blockTask](ExecutorThreadResult&, const uint32_t workBegin, const uint32_t workEnd)
+                       {
+                           for (auto blockIndex = workBegin; blockIndex < workEnd; ++blockIndex)
+                           {
+                               blockTask(blockIndex);
+                           }
+                       });
+    }
+
+    template<IsTriviallyCopyable T, typename TCompare>
+    void F_Executor::ParallelSort(const F_MutableContext& context, const std::span<T> values, TCompare compare)
+    {
+        const auto elementCount = values.size();
+        const auto blockCount = GetPrimitiveBlockCount(elementCount);
+        if (blockCount == 1)
+        {
+            std::sort(values.begin(), values.end(), compare);
+            return;
+        }
+
+        const auto blockBegin = [elementCount, blockCount](const size_t blockIndex)
+        {
+            return GetPrimitiveBlockBegin(elementCount, blockCount, std::min(blockIndex, blockCount));
+        };
+
+        ForEachBlock(context,
+                     blockCount,
+                     [values, &compare, &blockBegin](const size_t blockIndex)
+                     {
+                         std::sort(values.begin() + blockBegin(blockIndex), values.begin() + blockBegin(blockIndex + 1), compare);
+                     });
+
+        // 정렬된 블록이 width개씩 모인 구간들을 두 개씩 병합하여 source와 destination을 번갈아 사용.
+        auto source = values.data();
+        auto destination = GetScratch<T>(PrimitiveElementScratch, elementCount);
+        for (size_t width = 1; width < blockCount; width *= 2)
+        {
+            const auto mergeCount = (blockCount + 2 * width - 1) / (2 * width);
+            ForEachBlock(context,
+                         mergeCount,
+                         [source, destination, width, &compare, &blockBegin](const size_t mergeIndex)
+                         {
+                             const auto leftBegin = blockBegin(mergeIndex * 2 * width);
+                             const auto rightBegin = blockBegin(mergeIndex * 2 * width + width);
+                             const auto rightEnd = blockBegin(mergeIndex * 2 * width + 2 * width);
+                             std::merge(source + leftBegin,
+                                        source + rightBegin,
+                                        source + rightBegin,
+                                        source + rightEnd,
+                                        destination + leftBegin,
+                                        compare);
+                         });
+            std::swap(source, destination);
+        }
+
+        if (source != values.data())
+        {
+            ForEachBlock(context,
+                         blockCount,
+                         [source, values, &blockBegin](const size_t blockIndex)
+                         {
+                             std::copy(source + blockBegin(blockIndex), source + blockBegin(blockIndex + 1), values.begin() + blockBegin(blockIndex));
+                         });
+        }
+    }
+
+    template<IsTriviallyCopyable T, typename TOperation>
+    void F_Executor::ParallelInclusiveScan(const F_MutableContext& context, const std::span<T> values, TOperation operation)
+    {
+        const auto elementCount = values.size();
+        const auto blockCount = GetPrimitiveBlockCount(elementCount);
+        if (blockCount == 1)
+        {
+            std::inclusive_scan(values.begin(), values.end(), values.begin(), operation);
+            return;
+        }
+
+        // 블록별 합을 구해 순차적으로 누적한 후, 각 블록은 앞 블록까지의 누적값에서 이어서 스캔함.
+        const auto blockSums = GetScratch<T>(PrimitiveBlockScratch, blockCount);
+        ForEachBlock(context,
+                     blockCount,
+                     [values, blockSums, elementCount, blockCount, &operation](const size_t blockIndex)
+                     {
+                         const auto begin = values.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex);
+                         const auto end = values.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex + 1);
+                         // std::reduce는 원소 순서를 바꿀 수 있어 교환 법칙을 만족하지 않는 op에서 결과가 달라지므로 순서대로 누적함.
+                         blockSums[blockIndex] = std::accumulate(begin + 1, end, *begin, operation);
+                     });
+
+        for (size_t blockIndex = 1; blockIndex < blockCount; ++blockIndex)
         {
-            ThreadContexts[threadId - 1].WorkingFlag.wait(true, std::memory_order_acquire);
+            blockSums[blockIndex] = operation(blockSums[blockIndex - 1], blockSums[blockIndex]);
         }
 
-        return ExecutionResults<TExecutionResult>{ std::span{ ThreadResults.get(), WorkerThreadCount } };
+        ForEachBlock(context,
+                     blockCount,
+                     [values, blockSums, elementCount, blockCount, &operation](const size_t blockIndex)
+                     {
+                         const auto begin = values.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex);
+                         const auto end = values.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex + 1);
+                         if (blockIndex == 0)
+                         {
+                             std::inclusive_scan(begin, end, begin, operation);
+                         }
+                         else
+                         {
+                             std::inclusive_scan(begin, end, begin, operation, blockSums[blockIndex - 1]);
+                         }
+                     });
+    }
+
+    template<IsTriviallyCopyable T>
+    size_t F_Executor::ParallelCopyIf(const F_MutableContext& context,
+                                      const std::span<const T> input,
+                                      const std::span<T> output,
+                                      auto&& predicate)
+    {
+        const auto elementCount = input.size();
+        const auto blockCount = GetPrimitiveBlockCount(elementCount);
+        if (blockCount == 1)
+        {
+            const auto copiedEnd = std::copy_if(input.begin(), input.end(), output.begin(), predicate);
+            return static_cast<size_t>(copiedEnd - output.begin());
+        }
+
+        // 블록별 개수를 세어 출력 위치를 정한 후, 각 블록이 자신의 위치에 복사.
+        const auto blockOffsets = GetScratch<size_t>(PrimitiveBlockScratch, blockCount);
+        ForEachBlock(context,
+                     blockCount,
+                     [input, blockOffsets, elementCount, blockCount, &predicate](const size_t blockIndex)
+                     {
+                         blockOffsets[blockIndex] = std::count_if(
+                             input.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex),
+                             input.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex + 1),
+                             predicate);
+                     });
+
+        const auto lastBlockCount = blockOffsets[blockCount - 1];
+        std::exclusive_scan(blockOffsets, blockOffsets + blockCount, blockOffsets, size_t{ 0 });
+        const auto copiedCount = blockOffsets[blockCount - 1] + lastBlockCount;
+        SCRASH_COND(copiedCount > output.size());
+
+        ForEachBlock(context,
+                     blockCount,
+                     [input, output, blockOffsets, elementCount, blockCount, &predicate](const size_t blockIndex)
+                     {
+                         std::copy_if(input.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex),
+                                      input.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex + 1),
+                                      output.begin() + blockOffsets[blockIndex],
+                                      predicate);
+                     });
+        return copiedCount;
+    }
+
+    template<IsTriviallyCopyable T>
+    size_t F_Executor::ParallelPartition(const F_MutableContext& context, const std::span<T> values, auto&& predicate)
+    {
+        const auto elementCount = values.size();
+        const auto blockCount = GetPrimitiveBlockCount(elementCount);
+        if (blockCount == 1)
+        {
+            const auto partitionPoint = std::stable_partition(values.begin(), values.end(), predicate);
+            return static_cast<size_t>(partitionPoint - values.begin());
+        }
+
+        // 블록별로 만족하는 원소 수를 세어, 만족하는 원소는 앞쪽에서부터, 나머지는 분할 지점에서부터 블록 순서대로 자리를 정함.
+        const auto trueOffsets = GetScratch<size_t>(PrimitiveBlockScratch, blockCount + 1);
+        ForEachBlock(context,
+                     blockCount,
+                     [values, trueOffsets, elementCount, blockCount, &predicate](const size_t blockIndex)
+                     {
+                         trueOffsets[blockIndex] = std::count_if(
+                             values.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex),
+                             values.begin() + GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex + 1),
+                             predicate);
+                     });
+
+        trueOffsets[blockCount] = 0;
+        std::exclusive_scan(trueOffsets, trueOffsets + blockCount + 1, trueOffsets, size_t{ 0 });
+        const auto partitionPoint = trueOffsets[blockCount];
+
+        const auto partitioned = GetScratch<T>(PrimitiveElementScratch, elementCount);
+        ForEachBlock(context,
+                     blockCount,
+                     [values, trueOffsets, partitioned, partitionPoint, elementCount, blockCount, &predicate](const size_t blockIndex)
+                     {
+                         const auto begin = GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex);
+                         const auto end = GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex + 1);
+                         auto trueIndex = trueOffsets[blockIndex];
+                         auto falseIndex = partitionPoint + (begin - trueOffsets[blockIndex]);
+                         for (auto index = begin; index < end; ++index)
+                         {
+                             partitioned[predicate(values[index]) ? trueIndex++ : falseIndex++] = values[index];
+                         }
+                     });
+
+        ForEachBlock(context,
+                     blockCount,
+                     [values, partitioned, elementCount, blockCount](const size_t blockIndex)
+                     {
+                         const auto begin = GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex);
+                         const auto end = GetPrimitiveBlockBegin(elementCount, blockCount, blockIndex + 1);
+                         std::copy(partitioned + begin, partitioned + end, values.begin() + begin);
+                     });
+        return partitionPoint;
+    }
+
+    template<typename TResult>
+    std::future<TResult> F_Executor::Spawn(F_Task<TResult> task)
+    {
+        auto promise = std::make_shared<std::promise<TResult>>();
+        auto future = promise->get_future();
+        Schedule(RunSpawnedTask(std::move(task), std::move(promise)).Handle);
+        return future;
+    }
+
+    template<typename TResult>
+    F_DetachedTask F_Executor::RunSpawnedTask(F_Task<TResult> task, const std::shared_ptr<std::promise<TResult>> promise)
+    {
+        if constexpr (std::is_void_v<TResult>)
+        {
+            co_await task;
+            promise->set_value();
+        }
+        else
+        {
+            promise->set_value(co_await task);
+        }
+    }
+
+    inline F_Executor::ScheduleAwaiter F_Executor::Yield()
+    {
+        return ScheduleAwaiter{ *this };
+    }
+
+    template<typename TResult>
+    auto F_Executor::AwaitBackgroundJob(auto&& step)
+        requires IsBackgroundJobStep<TResult, decltype(step)>
+    {
+        return BackgroundJobAwaiter<TResult, std::decay_t<decltype(step)>>{ *this, std::forward<decltype(step)>(step) };
+    }
+
+    template<typename TResult>
+    std::future<TResult> F_Executor::SubmitBackgroundJob(auto&& step)
+        requires IsBackgroundJobStep<TResult, decltype(step)>
+    {
+        // std::function은 복사 가능해야 하므로 promise를 shared_ptr로 보관.
+        auto promise = std::make_shared<std::promise<TResult>>();
+        auto future = promise->get_future();
+        PushBackgroundJob([promise, step = std::forward<decltype(step)>(step)]() mutable
+        {
+            auto result = step();
+            if (!result)
+            {
+                return false;
+            }
+
+            promise->set_value(std::move(*result));
+            return true;
+        });
+        return future;
+    }
+
+    std::span<F_Executor::ExecutorThreadResult> F_Executor::DispatchNestedRanges(const size_t chunkSize,
+                                                                                 const size_t elementCount,
+                                                                                 auto&& processRange,
+                                                                                 const std::atomic_uint32_t* stopIndex)
+    {
+        while (NestedThreadResults.size() < TaskDepth)
+        {
+            NestedThreadResults.push_back(std::make_unique<ExecutorThreadResult[]>(WorkerThreadCount + 1));
+        }
+
+        const auto threadResults = NestedThreadResults[TaskDepth - 1].get();
+        for (uint32_t threadId = 0; threadId <= WorkerThreadCount; ++threadId)
+        {
+            threadResults[threadId].Clear();
+        }
+
+        NestedJob nestedJob
+        {
+            [&processRange, threadResults](const uint32_t threadId, const uint32_t workBegin, const uint32_t workEnd)
+            {
+                processRange(threadResults[threadId], workBegin, workEnd);
+            },
+            elementCount,
+            chunkSize,
+            0,
+            0,
+            stopIndex,
+        };
+        RunNestedJob(nestedJob);
+
+        return std::span{ threadResults, WorkerThreadCount + 1 };
     }
 
     inline void F_Executor::ExtendPageAtLeast(ExecutorThreadResult& threadResult, const size_t atLeast)
@@ -348,7 +1227,10 @@ namespace Core
                                        ? BaseThreadMemorySize
                                        : threadResult.MemoryBlockSize * 2;
             auto newBlock = std::make_unique<char[]>(newSize);
-            memcpy(newBlock.get(), threadResult.MemoryBlock.get(), oldSize);
+            if (oldSize > 0)
+            {
+                memcpy(newBlock.get(), threadResult.MemoryBlock.get(), oldSize);
+            }
             threadResult.MemoryBlock = std::move(newBlock);
             threadResult.MemoryBlockSize = newSize;
         }
@@ -358,59 +1240,114 @@ namespace Core
     F_Executor::ExecutionResults<TExecutionResult> F_Executor::ExecutorCommon(
         const F_MutableContext& context,
         const size_t chunkSize,
+        const size_t elementCount,
         auto&& getAxis,
         auto&& task)
     {
         const auto workerParameters = WorkerParameters{ context, static_cast<F_ImmutableContext>(context), chunkSize };
 
-        work_ = [this, &workerParameters, &task, &getAxis](const uint32_t threadId)
+        const auto processRange = [&workerParameters, &task, &getAxis](ExecutorThreadResult& threadResult,
+                                                                       const uint32_t workBegin,
+                                                                       const uint32_t workEnd)
         {
-            auto& threadResult = ThreadResults[threadId - 1];
-            while (true)
+            bool isSegmentOpened = false;
+            for (uint32_t i = workBegin; i < workEnd; ++i)
             {
-                const auto workEnd = multiThreadWorkIndex_.fetch_add(workerParameters.ChunkSize,
-                                                                     std::memory_order_relaxed);
-                const auto workBegin = workEnd - workerParameters.ChunkSize;
-
-                for (uint32_t i = static_cast<uint32_t>(workBegin); i < workEnd; ++i)
+                const auto axis = getAxis(workerParameters, i);
+                if (!axis.second)
                 {
-                    const auto axis = getAxis(workerParameters, i);
-                    if (!axis.second)
-                    {
-                        return;
-                    }
+                    continue;
+                }
 
-                    const auto result = task(axis.first, *axis.second, workerParameters);
-                    if (!result)
-                    {
-                        continue;
-                    }
+                const auto result = task(axis.first, *axis.second, workerParameters);
+                if (!result)
+                {
+                    continue;
+                }
 
-                    ExtendPageAtLeast(threadResult, sizeof(TExecutionResult) * (threadResult.ResultElementCount + 1));
-                    memcpy(
-                        threadResult.MemoryBlock.get() + sizeof(TExecutionResult) * threadResult.ResultElementCount,
-                        &*result,
-                        sizeof(TExecutionResult));
-                    threadResult.ResultElementCount += 1;
+                if (!isSegmentOpened)
+                {
+                    threadResult.Segments.push_back({ workBegin, static_cast<uint32_t>(threadResult.ResultElementCount) });
+                    isSegmentOpened = true;
                 }
+
+                ExtendPageAtLeast(threadResult, sizeof(TExecutionResult) * (threadResult.ResultElementCount + 1));
+                memcpy(
+                    threadResult.MemoryBlock.get() + sizeof(TExecutionResult) * threadResult.ResultElementCount,
+                    &*result,
+                    sizeof(TExecutionResult));
+                threadResult.ResultElementCount += 1;
             }
         };
 
-        multiThreadUpdateContext_ = &context;
-        multiThreadWorkIndex_.store(0, std::memory_order_relaxed);
+        return ExecutionResults<TExecutionResult>{ DispatchRanges(context, chunkSize, elementCount, processRange) };
+    }
 
-        for (int threadId = 1; threadId <= WorkerThreadCount; ++threadId)
+    std::span<F_Executor::ExecutorThreadResult> F_Executor::DispatchRanges(const F_MutableContext& context,
+                                                                           const size_t chunkSize,
+                                                                           const size_t elementCount,
+                                                                           auto&& processRange,
+                                                                           const std::atomic_uint32_t* stopIndex)
+    {
+        // task 안에서의 호출은 바깥 호출이 사용 중인 work_, multiThreadWorkIndex_, ThreadResults를 건드리지 않는 별도 경로로 처리.
+        if (TaskDepth > 0)
         {
-            ThreadResults[threadId - 1].ResultElementCount = 0;
-            ThreadContexts[threadId - 1].WorkingFlag.store(true, std::memory_order_release);
-            ThreadContexts[threadId - 1].WorkingFlag.notify_one();
+            return DispatchNestedRanges(chunkSize, elementCount, processRange, stopIndex);
         }
-        for (int threadId = 1; threadId <= WorkerThreadCount; ++threadId)
+
+        // 청크 하나로 끝나는 작업은 워커를 깨우는 비용이 더 크므로, 호출한 스레드에서 바로 처리하고 호출한 스레드의 결과 페이지를 사용함.
+        // 워커가 없는 F_Executor도 모든 범위를 같은 방식으로 호출한 스레드에서 처리함.
+        const auto chunkCount = (elementCount + chunkSize - 1) / chunkSize;
+        if (chunkCount <= 1 || WorkerThreadCount == 0)
         {
-            ThreadContexts[threadId - 1].WorkingFlag.wait(true, std::memory_order_acquire);
+            auto& callerThreadResult = ThreadResults[0];
+            callerThreadResult.Clear();
+            if (elementCount == 0)
+            {
+                return std::span<ExecutorThreadResult>{};
+            }
+
+            TaskDepth += 1;
+            processRange(callerThreadResult, 0, static_cast<uint32_t>(elementCount));
+            TaskDepth -= 1;
+            return std::span{ &callerThreadResult, 1 };
         }
 
-        return ExecutionResults<TExecutionResult>{ std::span{ ThreadResults.get(), WorkerThreadCount } };
+        work_ = [this, &processRange, chunkSize, elementCount, stopIndex](const uint32_t threadId)
+        {
+            auto& threadResult = ThreadResults[threadId];
+            while (true)
+            {
+                const auto workBegin = multiThreadWorkIndex_.fetch_add(static_cast<uint32_t>(chunkSize),
+                                                                       std::memory_order_relaxed);
+                if (workBegin >= elementCount
+                    || (stopIndex && workBegin >= stopIndex->load(std::memory_order_relaxed)))
+                {
+                    // 남은 청크가 없거나 더 처리할 필요가 없다면, 아직 끝나지 않은 다른 워커들의 중첩 작업을 도움.
+                    while (HelpNestedJob(threadId))
+                    {
+                    }
+                    return;
+                }
+
+                const auto workEnd = static_cast<uint32_t>(std::min<size_t>(workBegin + chunkSize, elementCount));
+                processRange(threadResult, workBegin, workEnd);
+
+                if (nestedJobCount_.load(std::memory_order_relaxed) > 0)
+                {
+                    HelpNestedJob(threadId);
+                }
+            }
+        };
+
+        // 호출한 스레드도 워커들과 같이 청크를 가져가 처리함. 청크 수보다 많은 워커를 깨우면 fetch_add 한 번만 하고 돌아가므로,
+        // 호출한 스레드 몫을 뺀 청크 수만큼만 깨움.
+        const auto wakeWorkerThreadCount = static_cast<uint32_t>(std::min<size_t>(activeWorkerThreadCount_, chunkCount - 1));
+        multiThreadUpdateContext_ = &context;
+        multiThreadWorkIndex_.store(0, std::memory_order_relaxed);
+        Dispatch(wakeWorkerThreadCount, true);
+
+        return std::span{ ThreadResults.get(), wakeWorkerThreadCount + 1 };
     }
 }
 
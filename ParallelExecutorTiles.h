@@ -0,0 +1,119 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_F_EXECUTORTILES_H
+#define CORE_F_EXECUTORTILES_H
+
+#include "F_Executor.h"
+#include "U_TiledDatas.h"
+#include <godot_cpp/variant/vector2i.hpp>
+#include <algorithm>
+#include <concepts>
+#include <functional>
+
+namespace Core
+{
+    template<typename T, typename Task>
+    concept IsParallelForTilesTask = requires(Task task,
+                                              const godot::Vector2i& position,
+                                              T& data,
+                                              const F_ImmutableContext& immutableContext)
+    {
+        { std::invoke(task, position, data, immutableContext) } -> std::same_as<void>;
+    };
+
+    template<typename TSource, typename TDestination, typename Task>
+    concept IsParallelForTilesStencilTask = requires(Task task,
+                                                     const godot::Vector2i& position,
+                                                     const U_TiledDatas<TSource>& source,
+                                                     const F_ImmutableContext& immutableContext)
+    {
+        { std::invoke(task, position, source, immutableContext) } -> std::same_as<TDestination>;
+    };
+
+    /**
+     * mapSize 격자를 tileBlockSize x tileBlockSize 블록으로 나누어 context.Executor로 병렬 처리하며,
+     * 블록 안의 모든 위치에 대해 행 우선으로 tileTask(위치)를 실행.
+     */
+    void ForEachTile(const F_MutableContext& context,
+                     const godot::Vector2i& mapSize,
+                     const int32_t tileBlockSize,
+                     auto&& tileTask)
+    {
+        SCRASH_COND(tileBlockSize <= 0);
+        if (mapSize.x <= 0 || mapSize.y <= 0)
+        {
+            return;
+        }
+
+        const auto blockCountX = (mapSize.x + tileBlockSize - 1) / tileBlockSize;
+        const auto blockCountY = (mapSize.y + tileBlockSize - 1) / tileBlockSize;
+        context.Executor.ForEachBlock(context,
+                                      static_cast<size_t>(blockCountX) * blockCountY,
+                                      [&tileTask, &mapSize, tileBlockSize, blockCountX](const size_t blockIndex)
+                                      {
+                                          const auto beginX = static_cast<int32_t>(blockIndex % blockCountX) * tileBlockSize;
+                                          const auto beginY = static_cast<int32_t>(blockIndex / blockCountX) * tileBlockSize;
+                                          const auto endX = std::min(beginX + tileBlockSize, mapSize.x);
+                                          const auto endY = std::min(beginY + tileBlockSize, mapSize.y);
+                                          for (auto y = beginY; y < endY; ++y)
+                                          {
+                                              for (auto x = beginX; x < endX; ++x)
+                                              {
+                                                  tileTask(godot::Vector2i{ x, y });
+                                              }
+                                          }
+                                      });
+    }
+
+    /**
+     * 격자를 tileBlockSize x tileBlockSize 블록으로 나누어 블록 단위로 워커들에게 분배하고, 블록 안에서는 행 우선으로
+     * 모든 타일에 task(위치, 타일 데이터, ImmutableContext)를 실행. 블록 하나가 캐시에 들어가므로 맵 전체를 도는 갱신에 적합함.
+     * @remarks task는 주어진 타일만 수정할 것. 이웃 타일을 읽어야 하면 원본과 대상을 나눈 스텐실 버전을 사용.
+     */
+    template<typename T>
+    void ParallelForTiles(const F_MutableContext& context,
+                          U_TiledDatas<T>& tiledDatas,
+                          auto&& task,
+                          const int32_t tileBlockSize = 64)
+        requires IsParallelForTilesTask<T, decltype(task)>
+    {
+        const auto immutableContext = static_cast<F_ImmutableContext>(context);
+        ForEachTile(context,
+                    tiledDatas.GetSize(),
+                    tileBlockSize,
+                    [&tiledDatas, &task, &immutableContext](const godot::Vector2i& position)
+                    {
+                        task(position, tiledDatas.GetDataAt(position), immutableContext);
+                    });
+    }
+
+    /**
+     * 스텐실 버전. destination의 각 타일을 task(위치, source, ImmutableContext)의 반환값으로 채움. source는 읽기만 하므로
+     * 블록 경계 너머의 이웃(halo)도 자유롭게 읽을 수 있음. 격자 밖은 source.TryGetDataAt()으로 확인할 것.
+     * @remarks source와 destination은 크기가 같고 서로 다른 격자여야 함.
+     */
+    template<typename TSource, typename TDestination>
+    void ParallelForTiles(const F_MutableContext& context,
+                          const U_TiledDatas<TSource>& source,
+                          U_TiledDatas<TDestination>& destination,
+                          auto&& task,
+                          const int32_t tileBlockSize = 64)
+        requires IsParallelForTilesStencilTask<TSource, TDestination, decltype(task)>
+    {
+        SCRASH_COND(source.GetSize() != destination.GetSize());
+        SCRASH_COND(static_cast<const void*>(&source) == static_cast<const void*>(&destination));
+
+        const auto immutableContext = static_cast<F_ImmutableContext>(context);
+        ForEachTile(context,
+                    source.GetSize(),
+                    tileBlockSize,
+                    [&source, &destination, &task, &immutableContext](const godot::Vector2i& position)
+                    {
+                        destination.GetDataAt(position) = task(position, source, immutableContext);
+                    });
+    }
+}
+
+#endif // CORE_F_EXECUTORTILES_H
@@ -0,0 +1,24 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_CONCEPT_COMMON_H
+#define CORE_SHIM_CONCEPT_COMMON_H
+
+#include "F_Entity.h"
+#include <concepts>
+#include <type_traits>
+
+namespace Core
+{
+    template<typename T>
+    concept IsComponent = std::is_base_of_v<I_Component, T>;
+
+    template<typename T>
+    concept IsEvent = std::is_base_of_v<I_Event, T>;
+
+    template<typename T>
+    concept IsTriviallyCopyable = std::is_trivially_copyable_v<T>;
+}
+
+#endif // CORE_SHIM_CONCEPT_COMMON_H
@@ -0,0 +1,77 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_F_ENTITY_H
+#define CORE_SHIM_F_ENTITY_H
+
+#include <cstdint>
+
+namespace Core
+{
+    struct I_Component
+    {
+    };
+
+    struct I_Event
+    {
+    };
+
+    /**
+     * 상위 VersionBitSize 비트는 버전, 하위 IdBitSize 비트는 Id.
+     */
+    class F_Entity final
+    {
+    public:
+        static constexpr uint32_t IdBitSize = 24;
+        static constexpr uint32_t VersionBitSize = 32 - IdBitSize;
+        static constexpr uint32_t NullId = (1u << IdBitSize) - 1;
+
+        constexpr F_Entity()
+            : value_{ 0xffffffff }
+        {
+        }
+
+        constexpr F_Entity(const uint32_t id, const uint32_t version)
+            : value_{ version << IdBitSize | (id & NullId) }
+        {
+        }
+
+        [[nodiscard]]
+        constexpr uint32_t GetId() const
+        {
+            return ParseIdOf(value_);
+        }
+
+        [[nodiscard]]
+        constexpr uint32_t GetVersion() const
+        {
+            return ParseVersionOf(value_);
+        }
+
+        [[nodiscard]]
+        static constexpr uint32_t ParseIdOf(const uint32_t value)
+        {
+            return value & NullId;
+        }
+
+        [[nodiscard]]
+        static constexpr uint32_t ParseVersionOf(const uint32_t value)
+        {
+            return value >> IdBitSize;
+        }
+
+        [[nodiscard]]
+        static constexpr F_Entity NullEntity()
+        {
+            return {};
+        }
+
+        constexpr bool operator==(const F_Entity&) const = default;
+
+    private:
+        uint32_t value_;
+    };
+}
+
+#endif // CORE_SHIM_F_ENTITY_H
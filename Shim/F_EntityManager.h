@@ -0,0 +1,95 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_F_ENTITYMANAGER_H
+#define CORE_SHIM_F_ENTITYMANAGER_H
+
+#include "Concept_Common.h"
+#include "F_SparseSet.h"
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+namespace Core
+{
+    /**
+     * 엔진의 F_EntityManager 중 F_Executor가 사용하는 부분과, 벤치마크가 데이터를 채우기 위한 생성 함수만 둔 것.
+     * 컴포넌트 타입마다 F_SparseSet 하나에 저장함.
+     */
+    class F_EntityManager final
+    {
+    public:
+        F_Entity CreateEntity()
+        {
+            return F_Entity{ nextEntityId_++, 0 };
+        }
+
+        template<IsComponent TComponent>
+        TComponent* CreateComponentFor(const F_Entity entity)
+        {
+            return GetSparseSet<TComponent>().CreateFor(entity);
+        }
+
+        template<IsComponent TComponent>
+        std::pair<F_Entity, const TComponent*> GetComponentFromDenseIndex(const uint32_t denseIndex) const
+        {
+            const auto sparseSet = FindSparseSet<TComponent>();
+            if (!sparseSet)
+            {
+                return { F_Entity::NullEntity(), nullptr };
+            }
+
+            return std::as_const(*sparseSet).GetByDenseIndex(denseIndex);
+        }
+
+        template<IsComponent TComponent>
+        std::pair<F_Entity, TComponent*> GetComponentFromDenseIndex(const uint32_t denseIndex)
+        {
+            const auto sparseSet = FindSparseSet<TComponent>();
+            if (!sparseSet)
+            {
+                return { F_Entity::NullEntity(), nullptr };
+            }
+
+            return sparseSet->GetByDenseIndex(denseIndex);
+        }
+
+        /**
+         * 해당 타입의 dense 배열 길이. F_Executor가 분배할 범위를 미리 알기 위해 사용함.
+         */
+        template<IsComponent TComponent>
+        [[nodiscard]]
+        size_t GetComponentCount() const
+        {
+            const auto sparseSet = FindSparseSet<TComponent>();
+            return sparseSet ? sparseSet->GetCount() : 0;
+        }
+
+    private:
+        std::unordered_map<std::type_index, std::unique_ptr<F_RawSparseSet>> sparseSets_;
+        uint32_t nextEntityId_ = 0;
+
+        template<IsComponent TComponent>
+        F_SparseSet<TComponent>* FindSparseSet() const
+        {
+            const auto iterator = sparseSets_.find(typeid(TComponent));
+            return iterator == sparseSets_.end() ? nullptr : static_cast<F_SparseSet<TComponent>*>(iterator->second.get());
+        }
+
+        template<IsComponent TComponent>
+        F_SparseSet<TComponent>& GetSparseSet()
+        {
+            auto& sparseSet = sparseSets_[typeid(TComponent)];
+            if (!sparseSet)
+            {
+                sparseSet = std::make_unique<F_SparseSet<TComponent>>();
+            }
+
+            return *static_cast<F_SparseSet<TComponent>*>(sparseSet.get());
+        }
+    };
+}
+
+#endif // CORE_SHIM_F_ENTITYMANAGER_H
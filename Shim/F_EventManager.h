@@ -0,0 +1,89 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_F_EVENTMANAGER_H
+#define CORE_SHIM_F_EVENTMANAGER_H
+
+#include "Concept_Common.h"
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace Core
+{
+    /**
+     * 엔진의 F_EventManager 중 F_Executor가 사용하는 부분과, 벤치마크가 이벤트를 쌓기 위한 Emit()만 둔 것.
+     * 이벤트 타입마다 하나의 큐에 발생 순서대로 저장함.
+     */
+    class F_EventManager final
+    {
+    public:
+        template<IsEvent TEvent>
+        void Emit(const TEvent& event)
+        {
+            GetEventQueue<TEvent>().Events.push_back(event);
+        }
+
+        template<IsEvent TEvent>
+        const TEvent* GetEventFromIndex(const uint32_t index) const
+        {
+            const auto eventQueue = FindEventQueue<TEvent>();
+            return eventQueue && index < eventQueue->Events.size() ? &eventQueue->Events[index] : nullptr;
+        }
+
+        template<IsEvent TEvent>
+        TEvent* GetEventFromIndex(const uint32_t index)
+        {
+            const auto eventQueue = FindEventQueue<TEvent>();
+            return eventQueue && index < eventQueue->Events.size() ? &eventQueue->Events[index] : nullptr;
+        }
+
+        /**
+         * 해당 타입의 큐에 쌓인 이벤트 수. F_Executor가 분배할 범위를 미리 알기 위해 사용함.
+         */
+        template<IsEvent TEvent>
+        [[nodiscard]]
+        size_t GetEventCount() const
+        {
+            const auto eventQueue = FindEventQueue<TEvent>();
+            return eventQueue ? eventQueue->Events.size() : 0;
+        }
+
+    private:
+        struct RawEventQueue
+        {
+            virtual ~RawEventQueue() = default;
+        };
+
+        template<IsEvent TEvent>
+        struct EventQueue final : RawEventQueue
+        {
+            std::vector<TEvent> Events;
+        };
+
+        std::unordered_map<std::type_index, std::unique_ptr<RawEventQueue>> eventQueues_;
+
+        template<IsEvent TEvent>
+        EventQueue<TEvent>* FindEventQueue() const
+        {
+            const auto iterator = eventQueues_.find(typeid(TEvent));
+            return iterator == eventQueues_.end() ? nullptr : static_cast<EventQueue<TEvent>*>(iterator->second.get());
+        }
+
+        template<IsEvent TEvent>
+        EventQueue<TEvent>& GetEventQueue()
+        {
+            auto& eventQueue = eventQueues_[typeid(TEvent)];
+            if (!eventQueue)
+            {
+                eventQueue = std::make_unique<EventQueue<TEvent>>();
+            }
+
+            return *static_cast<EventQueue<TEvent>*>(eventQueue.get());
+        }
+    };
+}
+
+#endif // CORE_SHIM_F_EVENTMANAGER_H
@@ -0,0 +1,11 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_F_SPARSESET_H
+#define CORE_SHIM_F_SPARSESET_H
+
+// 엔진에서의 파일 이름으로 포함할 수 있도록 저장소의 SparseSet.h을 그대로 포함함.
+#include "../SparseSet.h"
+
+#endif // CORE_SHIM_F_SPARSESET_H
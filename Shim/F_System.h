@@ -0,0 +1,43 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_F_SYSTEM_H
+#define CORE_SHIM_F_SYSTEM_H
+
+#include "F_EntityManager.h"
+#include "F_EventManager.h"
+#include <cstdint>
+
+namespace Core
+{
+    class F_Executor;
+
+    /**
+     * 시스템이 병렬 작업 안에서 받는 읽기 전용 컨텍스트.
+     */
+    struct F_ImmutableContext
+    {
+        const F_EntityManager& EntityManager;
+        const F_EventManager& EventManager;
+        uint64_t WorldCurrentTick;
+    };
+
+    /**
+     * 메인 스레드에서 시스템이 받는 컨텍스트.
+     */
+    struct F_MutableContext
+    {
+        F_EntityManager& EntityManager;
+        F_EventManager& EventManager;
+        F_Executor& Executor;
+        uint64_t WorldCurrentTick;
+
+        explicit operator F_ImmutableContext() const
+        {
+            return F_ImmutableContext{ EntityManager, EventManager, WorldCurrentTick };
+        }
+    };
+}
+
+#endif // CORE_SHIM_F_SYSTEM_H
@@ -0,0 +1,10 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_G_MAP_H
+#define CORE_SHIM_G_MAP_H
+
+// G_Pathfinder.cpp가 포함하지만 사용하는 선언은 없으므로 비워 둠.
+
+#endif // CORE_SHIM_G_MAP_H
@@ -0,0 +1,20 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_I_GLOBALOBJECT_H
+#define CORE_SHIM_I_GLOBALOBJECT_H
+
+namespace Core
+{
+    class I_GlobalObject
+    {
+    public:
+        virtual ~I_GlobalObject() = default;
+    };
+}
+
+// 엔진에서는 전역 객체를 등록하는 매크로. 독립 빌드에서는 등록할 곳이 없으므로 비워 둠.
+#define GLOBAL_OBJECT(Namespace, Name)
+
+#endif // CORE_SHIM_I_GLOBALOBJECT_H
@@ -0,0 +1,25 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_I_SINGLETON_H
+#define CORE_SHIM_I_SINGLETON_H
+
+namespace Core
+{
+    template<typename T>
+    class I_Singleton
+    {
+    public:
+        static T& GetSingleton();
+    };
+
+    template<typename T>
+    T& I_Singleton<T>::GetSingleton()
+    {
+        static T singleton;
+        return singleton;
+    }
+}
+
+#endif // CORE_SHIM_I_SINGLETON_H
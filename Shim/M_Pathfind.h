@@ -0,0 +1,80 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_M_PATHFIND_H
+#define CORE_SHIM_M_PATHFIND_H
+
+#include <godot_cpp/variant/vector2i.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+
+namespace Core::M_Pathfind
+{
+    /**
+     * 경로를 만든 스레드의 Id와 그 스레드 저장소 안에서의 경로 Id.
+     */
+    class PathHandle final
+    {
+    public:
+        PathHandle() = default;
+
+        PathHandle(const uint32_t pathHandlerThreadId, const uint32_t pathEntryId)
+            : pathHandlerThreadId_{ pathHandlerThreadId },
+              pathEntryId_{ pathEntryId }
+        {
+        }
+
+        [[nodiscard]]
+        uint32_t GetPathHandlerThreadId() const
+        {
+            return pathHandlerThreadId_;
+        }
+
+        [[nodiscard]]
+        uint32_t GetPathEntryId() const
+        {
+            return pathEntryId_;
+        }
+
+    private:
+        uint32_t pathHandlerThreadId_ = 0;
+        uint32_t pathEntryId_ = 0;
+    };
+
+    struct DirectionOffset
+    {
+        int32_t X;
+        int32_t Y;
+    };
+
+    constexpr uint64_t PathEntryRefreshIntervalWorldTick = 60;
+
+    constexpr uint32_t UnintializedFloodFillCell = 0xffffffff;
+
+    // 상하좌우를 먼저, 대각선을 나중에 둠.
+    constexpr std::array<DirectionOffset, 8> DirectionOffsets
+    {
+        DirectionOffset{ 1, 0 }, DirectionOffset{ -1, 0 }, DirectionOffset{ 0, 1 }, DirectionOffset{ 0, -1 },
+        DirectionOffset{ 1, 1 }, DirectionOffset{ 1, -1 }, DirectionOffset{ -1, 1 }, DirectionOffset{ -1, -1 },
+    };
+
+    /**
+     * 직선 10, 대각선 14 비용에 맞춘 옥타일 거리. 실제 비용을 넘지 않으므로 허용적임.
+     */
+    inline uint32_t GetH(const godot::Vector2i& from, const godot::Vector2i& to)
+    {
+        const auto deltaX = static_cast<uint32_t>(std::abs(from.x - to.x));
+        const auto deltaY = static_cast<uint32_t>(std::abs(from.y - to.y));
+        return 10 * std::max(deltaX, deltaY) + 4 * std::min(deltaX, deltaY);
+    }
+
+    inline bool IsValidPosition(const godot::Vector2i& mapSize, const godot::Vector2i& position)
+    {
+        return position.x >= 0 && position.y >= 0 && position.x < mapSize.x && position.y < mapSize.y;
+    }
+}
+
+#endif // CORE_SHIM_M_PATHFIND_H
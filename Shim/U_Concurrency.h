@@ -0,0 +1,15 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_U_CONCURRENCY_H
+#define CORE_SHIM_U_CONCURRENCY_H
+
+#include <cstddef>
+
+namespace Core::U_Concurrency
+{
+    constexpr size_t CacheLineSize = 64;
+}
+
+#endif // CORE_SHIM_U_CONCURRENCY_H
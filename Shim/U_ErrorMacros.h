@@ -0,0 +1,52 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_U_ERRORMACROS_H
+#define CORE_SHIM_U_ERRORMACROS_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+// 엔진의 오류 매크로와 같은 의미. 엔진은 Godot 로그로 출력하지만, 여기서는 표준 오류로 출력함.
+#define SCRASH_COND(condition)                                                              \
+    do                                                                                      \
+    {                                                                                       \
+        if (condition)                                                                      \
+        {                                                                                   \
+            std::fprintf(stderr, "%s:%d: SCRASH_COND(%s)\n", __FILE__, __LINE__, #condition); \
+            std::abort();                                                                   \
+        }                                                                                   \
+    } while (false)
+
+// 엔진의 매크로처럼 message는 문자열뿐 아니라 Id 같은 정수도 받으므로, 형식 문자열 대신 스트림으로 출력함.
+#define SCRASH_COND_MSG(condition, message)                                                                    \
+    do                                                                                                         \
+    {                                                                                                          \
+        if (condition)                                                                                         \
+        {                                                                                                      \
+            std::cerr << __FILE__ << ':' << __LINE__ << ": SCRASH_COND(" #condition "): " << (message) << std::endl; \
+            std::abort();                                                                                      \
+        }                                                                                                      \
+    } while (false)
+
+#define ERR_FAIL_COND(condition) \
+    do                           \
+    {                            \
+        if (condition)           \
+        {                        \
+            return;              \
+        }                        \
+    } while (false)
+
+#define ERR_FAIL_COND_V(condition, returnValue) \
+    do                                          \
+    {                                           \
+        if (condition)                          \
+        {                                       \
+            return returnValue;                 \
+        }                                       \
+    } while (false)
+
+#endif // CORE_SHIM_U_ERRORMACROS_H
@@ -0,0 +1,129 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_U_MEMORYPOOL_SPARSEARRAY_H
+#define CORE_SHIM_U_MEMORYPOOL_SPARSEARRAY_H
+
+#include "U_ErrorMacros.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Core::U_MemoryPool
+{
+    /**
+     * 원소마다 재사용되는 Id를 부여하는 풀. 원소는 고정 크기 페이지에 저장되며 페이지는 해제하거나 옮기지 않으므로,
+     * 살아 있는 원소의 주소는 Erase 전까지 유지됨. 페이지 표도 고정 크기라, 다른 스레드가 이미 받은 Id의 원소를 읽는 동안
+     * 소유 스레드가 새 원소를 추가해도 읽는 쪽이 보는 메모리는 바뀌지 않음.
+     */
+    template<typename T>
+    class SparseArray final
+    {
+    public:
+        SparseArray() = default;
+
+        ~SparseArray()
+        {
+            for (uint32_t id = 0; id < nextId_; ++id)
+            {
+                if (const auto element = Get(id))
+                {
+                    element->~T();
+                }
+            }
+        }
+
+        SparseArray(const SparseArray&) = delete;
+
+        SparseArray& operator=(const SparseArray&) = delete;
+
+        /**
+         * Id [0, count)의 원소를 담을 페이지와, 그만큼의 원소를 지웠을 때의 Free List 공간을 미리 할당.
+         */
+        void Reserve(const uint32_t count)
+        {
+            SCRASH_COND(count > ElementsPerPage * MaxPageCount);
+            for (uint32_t pageIndex = 0; pageIndex < (count + ElementsPerPage - 1) / ElementsPerPage; ++pageIndex)
+            {
+                if (!pages_[pageIndex])
+                {
+                    pages_[pageIndex] = std::make_unique<Page>();
+                }
+            }
+            freeIds_.reserve(count);
+        }
+
+        template<typename... TArgs>
+        std::pair<uint32_t, T*> Emplace(TArgs&&... args)
+        {
+            uint32_t id;
+            if (!freeIds_.empty())
+            {
+                id = freeIds_.back();
+                freeIds_.pop_back();
+            }
+            else
+            {
+                SCRASH_COND(nextId_ >= ElementsPerPage * MaxPageCount);
+                id = nextId_++;
+                auto& page = pages_[id / ElementsPerPage];
+                if (!page)
+                {
+                    page = std::make_unique<Page>();
+                }
+            }
+
+            auto& slot = pages_[id / ElementsPerPage]->Slots[id % ElementsPerPage];
+            const auto element = new(slot.Storage) T{ std::forward<TArgs>(args)... };
+            slot.IsAlive = true;
+            return { id, element };
+        }
+
+        T* Get(const uint32_t id) const
+        {
+            // nextId_는 소유 스레드만 바꾸므로, 다른 스레드도 읽을 수 있도록 페이지 존재 여부로 확인함.
+            if (id >= ElementsPerPage * MaxPageCount || !pages_[id / ElementsPerPage])
+            {
+                return nullptr;
+            }
+
+            auto& slot = pages_[id / ElementsPerPage]->Slots[id % ElementsPerPage];
+            return slot.IsAlive ? std::launder(reinterpret_cast<T*>(slot.Storage)) : nullptr;
+        }
+
+        void EraseBySparseIndex(const uint32_t id)
+        {
+            const auto element = Get(id);
+            ERR_FAIL_COND(!element);
+
+            element->~T();
+            pages_[id / ElementsPerPage]->Slots[id % ElementsPerPage].IsAlive = false;
+            freeIds_.push_back(id);
+        }
+
+    private:
+        static constexpr uint32_t ElementsPerPage = 1024;
+        static constexpr uint32_t MaxPageCount = 4096;
+
+        struct Slot
+        {
+            alignas(T) std::byte Storage[sizeof(T)];
+            bool IsAlive = false;
+        };
+
+        struct Page
+        {
+            std::array<Slot, ElementsPerPage> Slots;
+        };
+
+        std::array<std::unique_ptr<Page>, MaxPageCount> pages_;
+        std::vector<uint32_t> freeIds_;
+        uint32_t nextId_ = 0;
+    };
+}
+
+#endif // CORE_SHIM_U_MEMORYPOOL_SPARSEARRAY_H
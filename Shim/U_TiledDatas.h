@@ -0,0 +1,65 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_U_TILEDDATAS_H
+#define CORE_SHIM_U_TILEDDATAS_H
+
+#include <godot_cpp/variant/vector2i.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace Core
+{
+    /**
+     * 격자의 타일마다 T 하나를 행 우선으로 저장.
+     */
+    template<typename T>
+    class U_TiledDatas final
+    {
+    public:
+        [[nodiscard]]
+        godot::Vector2i GetSize() const
+        {
+            return size_;
+        }
+
+        void Resize(const godot::Vector2i& size, const T& value)
+        {
+            size_ = size;
+            datas_.assign(static_cast<size_t>(size.x) * size.y, value);
+        }
+
+        T& GetDataAt(const godot::Vector2i& position)
+        {
+            return datas_[static_cast<size_t>(position.y) * size_.x + position.x];
+        }
+
+        const T& GetDataAt(const godot::Vector2i& position) const
+        {
+            return datas_[static_cast<size_t>(position.y) * size_.x + position.x];
+        }
+
+        T* TryGetDataAt(const godot::Vector2i& position)
+        {
+            return IsInside(position) ? &GetDataAt(position) : nullptr;
+        }
+
+        const T* TryGetDataAt(const godot::Vector2i& position) const
+        {
+            return IsInside(position) ? &GetDataAt(position) : nullptr;
+        }
+
+    private:
+        godot::Vector2i size_;
+        std::vector<T> datas_;
+
+        [[nodiscard]]
+        bool IsInside(const godot::Vector2i& position) const
+        {
+            return position.x >= 0 && position.y >= 0 && position.x < size_.x && position.y < size_.y;
+        }
+    };
+}
+
+#endif // CORE_SHIM_U_TILEDDATAS_H
@@ -0,0 +1,43 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_GODOT_RECT2I_HPP
+#define CORE_SHIM_GODOT_RECT2I_HPP
+
+#include "vector2i.hpp"
+
+namespace godot
+{
+    /**
+     * godot-cpp의 Rect2i 중 이 저장소가 사용하는 부분.
+     */
+    struct Rect2i
+    {
+        Vector2i position;
+        Vector2i size;
+
+        Rect2i() = default;
+
+        Rect2i(const Vector2i& position, const Vector2i& size)
+            : position{ position },
+              size{ size }
+        {
+        }
+
+        [[nodiscard]]
+        bool has_point(const Vector2i& point) const
+        {
+            return point.x >= position.x && point.y >= position.y
+                   && point.x < position.x + size.x && point.y < position.y + size.y;
+        }
+
+        [[nodiscard]]
+        Vector2i get_end() const
+        {
+            return position + size;
+        }
+    };
+}
+
+#endif // CORE_SHIM_GODOT_RECT2I_HPP
@@ -0,0 +1,42 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef CORE_SHIM_GODOT_VECTOR2I_HPP
+#define CORE_SHIM_GODOT_VECTOR2I_HPP
+
+#include <cstdint>
+
+namespace godot
+{
+    /**
+     * godot-cpp의 Vector2i 중 이 저장소가 사용하는 부분.
+     */
+    struct Vector2i
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+
+        Vector2i() = default;
+
+        Vector2i(const int32_t x, const int32_t y)
+            : x{ x },
+              y{ y }
+        {
+        }
+
+        Vector2i operator+(const Vector2i& other) const
+        {
+            return { x + other.x, y + other.y };
+        }
+
+        Vector2i operator-(const Vector2i& other) const
+        {
+            return { x - other.x, y - other.y };
+        }
+
+        bool operator==(const Vector2i&) const = default;
+    };
+}
+
+#endif // CORE_SHIM_GODOT_VECTOR2I_HPP
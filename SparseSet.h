@@ -8,6 +8,8 @@
 #include "Concept_Common.h"
 #include "F_Entity.h"
 #include "U_ErrorMacros.h"
+#include <cstring>
+#include <limits>
 #include <vector>
 
 namespace Core
@@ -133,13 +135,13 @@ namespace Core
             }
 
             [[nodiscard]]
-            Iterator begin() requires !Const
+            Iterator begin() requires (!Const)
             {
                 return Iterator{ sparseSet_, 0 };
             }
 
             [[nodiscard]]
-            Iterator end() requires !Const
+            Iterator end() requires (!Const)
             {
                 return Iterator{ sparseSet_, NullIndex };
             }
@@ -325,6 +327,12 @@ namespace Core
             return { entity, const_cast<TComponent*>(constComponent) };
         }
 
+        [[nodiscard]]
+        size_t GetCount() const
+        {
+            return count_;
+        }
+
         [[nodiscard]]
         Iterable GetIterable()
         {
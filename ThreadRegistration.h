@@ -6,17 +6,19 @@
 #define CORE_F_THREADS_H
 
 #include "I_Singleton.h"
+#include "U_Concurrency.h"
 #include "U_ErrorMacros.h"
-#include <algorithm>
-#include <mutex>
-#include <vector>
+#include <array>
+#include <atomic>
+#include <memory>
 
 namespace Core
 {
     /**
      * ThreadId는 메인 스레드는 0으로, 워커 스레드는 1부터 연속적인 값으로 할당됨.
      * 스레드별 컨테이너를 필요로 하는 클래스가 있다면, GetThreadCount()만큼의 배열을 할당한 후 ThreadId를 인덱스로 사용하면
-     * 스레드 안전한 컨테이너를 생성 가능할 것임.
+     * 스레드 안전한 컨테이너를 생성 가능할 것임. F_PerThread가 이를 대신해 줌.
+     * 등록과 해제는 ThreadId별 atomic 슬롯에 대한 exchange 한 번으로 이루어지며, 스레드 수는 LockRegistration() 시점에 한 번만 계산하여 저장함.
      */
     class F_Threads final : public I_Singleton<F_Threads>
     {
@@ -25,86 +27,131 @@ namespace Core
 
         constexpr static uint32_t MainThreadId = 0;
         constexpr static uint32_t UnregisteredThreadId = 0xffffffff;
+        constexpr static uint32_t MaxThreadCount = 256;
 
         void RegisterCurrentThread(const uint32_t threadId)
         {
-            std::lock_guard lock{ mutex_ };
-
-            SCRASH_COND(registrationLocked_);
+            SCRASH_COND(registrationLocked_.load(std::memory_order_acquire));
             SCRASH_COND_MSG(CurrentThreadId != UnregisteredThreadId, CurrentThreadId);
-            CurrentThreadId = threadId;
-
-            for (int existingThreadId = 0; existingThreadId < registeredThreads_.size(); ++existingThreadId)
-            {
-                SCRASH_COND_MSG(existingThreadId == threadId && registeredThreads_[existingThreadId], threadId);
-            }
+            SCRASH_COND_MSG(threadId >= MaxThreadCount, threadId);
 
-            // ReSharper disable once CppDFALoopConditionNotUpdated
-            while (registeredThreads_.size() <= threadId)
-            {
-                registeredThreads_.push_back(false);
-            }
-            registeredThreads_[threadId] = true;
+            const bool wasRegistered = registeredThreads_[threadId].exchange(true, std::memory_order_acq_rel);
+            SCRASH_COND_MSG(wasRegistered, threadId);
             CurrentThreadId = threadId;
         }
 
         void UnregisterCurrentThread()
         {
-            std::lock_guard lock{ mutex_ };
-            SCRASH_COND(!registrationLocked_);
+            SCRASH_COND(!registrationLocked_.load(std::memory_order_acquire));
             SCRASH_COND(CurrentThreadId == UnregisteredThreadId);
-            registeredThreads_[CurrentThreadId] = false;
-            if (CurrentThreadId == registeredThreads_.size() - 1)
-            {
-                registeredThreads_.pop_back();
-            }
+            registeredThreads_[CurrentThreadId].store(false, std::memory_order_release);
         }
 
         [[nodiscard]]
         uint32_t GetCurrentThreadId() const
         {
-            SCRASH_COND(!registrationLocked_);
+            SCRASH_COND(!registrationLocked_.load(std::memory_order_relaxed));
             SCRASH_COND(CurrentThreadId == UnregisteredThreadId);
             return CurrentThreadId;
         }
 
+        /**
+         * 검사 없이 thread_local 값만 읽음. 등록된 스레드에서만, 등록이 잠긴 동안에만 호출할 것.
+         */
+        [[nodiscard]]
+        static uint32_t GetCurrentThreadIdUnchecked()
+        {
+            return CurrentThreadId;
+        }
+
         [[nodiscard]]
         size_t GetThreadCount() const
         {
-            SCRASH_COND(!registrationLocked_);
-            const bool isAllThreadRegisteredContiguously = std::ranges::all_of(registeredThreads_,
-                                                                               [](const bool isRegistered)
-                                                                               {
-                                                                                   return isRegistered;
-                                                                               });
-            SCRASH_COND(!isAllThreadRegisteredContiguously);
-
-            return registeredThreads_.size();
+            SCRASH_COND(!registrationLocked_.load(std::memory_order_relaxed));
+            return threadCount_;
         }
 
+        /**
+         * 이 시점에 등록된 스레드들이 0부터 연속적이어야 하며, 그 수를 GetThreadCount()의 값으로 고정함.
+         */
         void LockRegistration()
         {
-            std::lock_guard lock{ mutex_ };
-            SCRASH_COND(registrationLocked_);
-            registrationLocked_ = true;
+            SCRASH_COND(registrationLocked_.load(std::memory_order_relaxed));
+
+            uint32_t threadCount = 0;
+            while (threadCount < MaxThreadCount && registeredThreads_[threadCount].load(std::memory_order_acquire))
+            {
+                threadCount += 1;
+            }
+            for (auto threadId = threadCount; threadId < MaxThreadCount; ++threadId)
+            {
+                SCRASH_COND_MSG(registeredThreads_[threadId].load(std::memory_order_acquire), threadId);
+            }
+
+            threadCount_ = threadCount;
+            registrationLocked_.store(true, std::memory_order_release);
         }
 
         void UnlockRegistration()
         {
-            std::lock_guard lock{ mutex_ };
-            SCRASH_COND(!registrationLocked_);
-            registrationLocked_ = false;
+            SCRASH_COND(!registrationLocked_.load(std::memory_order_relaxed));
+            registrationLocked_.store(false, std::memory_order_release);
         }
 
     private:
         F_Threads() = default;
 
         inline static thread_local uint32_t CurrentThreadId = UnregisteredThreadId;
-        std::vector<bool> registeredThreads_;
-        bool registrationLocked_{ false };
-        std::mutex mutex_;
+        std::array<std::atomic_bool, MaxThreadCount> registeredThreads_{};
+        std::atomic_bool registrationLocked_{ false };
+        size_t threadCount_{ 0 };
     };
 
+    /**
+     * 스레드마다 하나씩의 T를 캐시 라인 단위로 떨어뜨려 보관하는 저장소. 등록이 잠긴 이후(워커 스레드 생성 이후)에 생성해야 함.
+     * std::unique_ptr<T[]>처럼 const 여부가 원소에 전파되지 않으므로, const 멤버 함수에서도 자신의 슬롯을 수정할 수 있음.
+     * @tparam T
+     */
+    template<typename T>
+    class F_PerThread final
+    {
+    public:
+        explicit F_PerThread()
+            : ThreadCount{ static_cast<uint32_t>(F_Threads::GetSingleton().GetThreadCount()) },
+              Slots{ std::make_unique<Slot[]>(ThreadCount) }
+        {
+        }
+
+        /**
+         * 현재 스레드의 슬롯. thread_local 읽기와 인덱싱만으로 이루어짐.
+         */
+        [[nodiscard]]
+        T& Local() const
+        {
+            return Slots[F_Threads::GetCurrentThreadIdUnchecked()].Value;
+        }
+
+        [[nodiscard]]
+        T& operator[](const uint32_t threadId) const
+        {
+            return Slots[threadId].Value;
+        }
+
+        [[nodiscard]]
+        uint32_t GetThreadCount() const
+        {
+            return ThreadCount;
+        }
+
+    private:
+        struct alignas(U_Concurrency::CacheLineSize) Slot
+        {
+            T Value;
+        };
+
+        const uint32_t ThreadCount;
+        const std::unique_ptr<Slot[]> Slots;
+    };
 }
 
 #endif // CORE_F_THREADS_H
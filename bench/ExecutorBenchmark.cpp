@@ -0,0 +1,397 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+// 작업 분배 벤치마크. 같은 합성 워크로드(원소 수, 원소별 비용 분포, 청크 크기, 스레드 수의 조합)를 현재의 F_Executor,
+// FetchAdd_Good_Cpu의 fetch_add 커서 F_SystemManager, CAS_Bad_Cpu의 CAS 커서 F_SystemManager로 각각 처리하고,
+// 분배 한 번(Dispatch)마다의 처리량, 지연 시간(p50/p99), getrusage로 잰 CPU 시간과 컨텍스트 스위치 수를 출력함.
+// 어느 설계를 빌드할지는 컴파일 정의로 고르며(정의 없음: F_Executor, EXECUTOR_BENCHMARK_DESIGN_FETCH_ADD,
+// EXECUTOR_BENCHMARK_DESIGN_CAS), 세 실행 파일의 출력 형식과 워크로드는 같으므로 줄 단위로 비교할 수 있음.
+// 스레드 수는 원소를 처리하는 스레드의 수임. F_Executor는 호출한 스레드도 처리하므로 워커를 하나 적게 만들고,
+// 이전 F_SystemManager들은 메인 스레드가 기다리기만 하므로 워커를 스레드 수만큼 만듦.
+// 사용법: ExecutorBenchmark [최대 스레드 수 = 하드웨어 스레드 수] [측정당 최소 시간(초) = 0.2] [원소당 평균 반복 수 = 64]
+
+#if defined(EXECUTOR_BENCHMARK_DESIGN_CAS) || defined(EXECUTOR_BENCHMARK_DESIGN_FETCH_ADD)
+#include "F_SystemManager.h"
+#include "F_EntityManager.h"
+#include "F_EventManager.h"
+#else
+#include "F_EntityManager.h"
+#include "F_EventManager.h"
+#include "F_Executor.h"
+#include "F_System.h"
+#include "F_Threads.h"
+#endif
+
+#include <sys/resource.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t RandomSeed = 20261018;
+    constexpr size_t WarmUpDispatchCount = 3;
+    constexpr size_t MinimumDispatchCount = 5;
+    constexpr size_t MaximumDispatchCount = 100000;
+    constexpr std::array<size_t, 3> ElementCounts{ 1024, 16384, 262144 };
+
+    thread_local uint64_t workSink = 0;
+
+    /**
+     * 원소 하나의 작업. 반복 수만큼 xorshift를 돌려 스레드별 변수에 남기므로 컴파일러가 지우지 못하며 공유 메모리도 건드리지 않음.
+     */
+    void DoWork(const uint32_t iterationCount)
+    {
+        auto state = workSink | 1;
+        for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+        }
+        workSink = state;
+    }
+
+#if defined(EXECUTOR_BENCHMARK_DESIGN_CAS) || defined(EXECUTOR_BENCHMARK_DESIGN_FETCH_ADD)
+    struct C_BenchmarkWork final
+    {
+        uint32_t IterationCount;
+    };
+
+    struct S_BenchmarkWork final
+    {
+        static void Process(const F_ProcessParams& processParams)
+        {
+            DoWork(static_cast<const C_BenchmarkWork*>(processParams.AxisComponentPtr)->IterationCount);
+        }
+
+        static void Apply(const F_ApplyParams&)
+        {
+        }
+
+        static void ReleaseRevisionDataNodes(std::atomic<F_RevisionDataNode*>&)
+        {
+        }
+
+        inline static const F_MultiThreadSystemBlueprint MultiThreadSystemBlueprint{ typeid(C_BenchmarkWork),
+                                                                                     &Process,
+                                                                                     &Apply,
+                                                                                     &ReleaseRevisionDataNodes };
+    };
+
+    /**
+     * 이전 F_SystemManager에 시스템 하나를 등록하고 Update()를 분배 한 번으로 측정함. 분배 단위는 설계에 고정되어 있음.
+     */
+    class DesignUnderTest final
+    {
+    public:
+#if defined(EXECUTOR_BENCHMARK_DESIGN_CAS)
+        static constexpr const char* Name = "CAS cursor F_SystemManager (CAS_Bad_Cpu)";
+        static constexpr std::array<size_t, 1> ChunkSizes{ 1 };
+#else
+        static constexpr const char* Name = "fetch_add cursor F_SystemManager (FetchAdd_Good_Cpu)";
+        static constexpr std::array<size_t, 1> ChunkSizes{ 32 };
+#endif
+        static constexpr bool IsChunkSizeFixed = true;
+
+        explicit DesignUnderTest(const uint32_t threadCount)
+            : state_{ new State{} }
+        {
+            // 이전 F_SystemManager의 워커는 detach되어 멈출 방법이 없으므로, 관리자와 그것이 참조하는 객체들을 일부러 해제하지 않음.
+            state_->SystemManager = new F_SystemManager{ state_->EntityManager, state_->EventManager, static_cast<int>(threadCount) };
+            state_->SystemManager->RegisterMultiThreadSystem<S_BenchmarkWork>();
+
+            // 워커들이 시작하며 출력하는 줄이 결과 사이에 끼지 않도록 기다림.
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 100 });
+            std::fflush(stdout);
+        }
+
+        void Populate(const std::vector<uint32_t>& iterationCounts)
+        {
+            state_->EntityManager.ClearComponents();
+            for (const auto iterationCount : iterationCounts)
+            {
+                const auto entity = state_->EntityManager.CreateEntity();
+                state_->EntityManager.CreateComponentFor<C_BenchmarkWork>(entity)->IterationCount = iterationCount;
+            }
+        }
+
+        void Dispatch(size_t)
+        {
+            state_->SystemManager->Update(0.0, 1, ++currentTick_);
+        }
+
+    private:
+        struct State final
+        {
+            F_EntityManager EntityManager;
+            F_EventManager EventManager;
+            F_SystemManager* SystemManager;
+        };
+
+        State* const state_;
+        uint64_t currentTick_ = 0;
+    };
+#else
+    struct C_BenchmarkWork final : Core::I_Component
+    {
+        uint32_t IterationCount;
+    };
+
+    /**
+     * F_Executor::ParallelForComponents()를 분배 한 번으로 측정함. 결과를 내지 않는 작업이므로 결과 취합 비용은 포함되지 않음.
+     */
+    class DesignUnderTest final
+    {
+    public:
+        static constexpr const char* Name = "F_Executor";
+        static constexpr std::array<size_t, 3> ChunkSizes{ 1, 32, 256 };
+        static constexpr bool IsChunkSizeFixed = false;
+
+        explicit DesignUnderTest(const uint32_t threadCount)
+            : executor_{ threadCount - 1 },
+              entityManager_{ std::make_unique<Core::F_EntityManager>() }
+        {
+        }
+
+        void Populate(const std::vector<uint32_t>& iterationCounts)
+        {
+            entityManager_ = std::make_unique<Core::F_EntityManager>();
+            for (const auto iterationCount : iterationCounts)
+            {
+                const auto entity = entityManager_->CreateEntity();
+                entityManager_->CreateComponentFor<C_BenchmarkWork>(entity)->IterationCount = iterationCount;
+            }
+        }
+
+        void Dispatch(const size_t chunkSize)
+        {
+            const Core::F_MutableContext context{ *entityManager_, eventManager_, executor_, ++currentTick_ };
+            static_cast<void>(executor_.ParallelForComponents<C_BenchmarkWork, uint32_t>(
+                context,
+                [](Core::F_Entity, const C_BenchmarkWork& work, const Core::F_ImmutableContext&) -> std::optional<uint32_t>
+                {
+                    DoWork(work.IterationCount);
+                    return std::nullopt;
+                },
+                chunkSize));
+        }
+
+    private:
+        Core::F_Executor executor_;
+        std::unique_ptr<Core::F_EntityManager> entityManager_;
+        Core::F_EventManager eventManager_;
+        uint64_t currentTick_ = 0;
+    };
+#endif
+
+    enum class E_CostDistribution
+    {
+        Constant, // 모든 원소가 평균 비용.
+        Uniform, // [0, 평균 비용 * 2]의 균등 분포.
+        HeavyTailed, // 99%는 평균의 절반, 1%는 평균의 50.5배.
+        Clustered, // 앞쪽 1/16의 원소만 평균의 16배이고 나머지는 0. 연속된 범위를 나누어 가지는 분배의 부하 불균형을 드러냄.
+    };
+
+    constexpr std::array<E_CostDistribution, 4> CostDistributions{ E_CostDistribution::Constant,
+                                                                   E_CostDistribution::Uniform,
+                                                                   E_CostDistribution::HeavyTailed,
+                                                                   E_CostDistribution::Clustered };
+
+    const char* GetCostDistributionName(const E_CostDistribution costDistribution)
+    {
+        switch (costDistribution)
+        {
+            case E_CostDistribution::Constant:
+                return "constant";
+            case E_CostDistribution::Uniform:
+                return "uniform";
+            case E_CostDistribution::HeavyTailed:
+                return "heavy-tail";
+            case E_CostDistribution::Clustered:
+                return "clustered";
+        }
+        return "";
+    }
+
+    /**
+     * 원소별 반복 수. 설계마다 같은 값을 받도록 매번 같은 시드로 만듦.
+     */
+    std::vector<uint32_t> MakeIterationCounts(const E_CostDistribution costDistribution,
+                                              const size_t elementCount,
+                                              const uint32_t meanIterationCount)
+    {
+        std::mt19937 random{ RandomSeed };
+        std::vector<uint32_t> iterationCounts(elementCount);
+        for (size_t elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+        {
+            switch (costDistribution)
+            {
+                case E_CostDistribution::Constant:
+                    iterationCounts[elementIndex] = meanIterationCount;
+                    break;
+                case E_CostDistribution::Uniform:
+                    iterationCounts[elementIndex] = std::uniform_int_distribution<uint32_t>{ 0, meanIterationCount * 2 }(random);
+                    break;
+                case E_CostDistribution::HeavyTailed:
+                    iterationCounts[elementIndex] = std::uniform_int_distribution<uint32_t>{ 0, 99 }(random) == 0
+                                                    ? meanIterationCount * 101 / 2
+                                                    : meanIterationCount / 2;
+                    break;
+                case E_CostDistribution::Clustered:
+                    iterationCounts[elementIndex] = elementIndex < elementCount / 16 ? meanIterationCount * 16 : 0;
+                    break;
+            }
+        }
+        return iterationCounts;
+    }
+
+    struct ResourceUsage final
+    {
+        double CpuSeconds; // 프로세스의 모든 스레드가 사용한 user + system 시간.
+        long VoluntaryContextSwitchCount;
+        long InvoluntaryContextSwitchCount;
+    };
+
+    ResourceUsage GetResourceUsage()
+    {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return ResourceUsage{ static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+                              + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6,
+                              usage.ru_nvcsw,
+                              usage.ru_nivcsw };
+    }
+
+    struct DispatchSummary final
+    {
+        size_t DispatchCount;
+        double WallSeconds;
+        uint64_t P50Nanoseconds;
+        uint64_t P99Nanoseconds;
+        ResourceUsage Usage; // 측정 구간 동안의 증가량.
+    };
+
+    /**
+     * 최소 시간과 최소 횟수를 모두 채울 때까지 분배를 반복함. 측정 구간 앞뒤로만 getrusage를 호출함.
+     */
+    DispatchSummary MeasureDispatches(DesignUnderTest& design, const size_t chunkSize, const double minimumSeconds)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        for (size_t dispatchIndex = 0; dispatchIndex < WarmUpDispatchCount; ++dispatchIndex)
+        {
+            design.Dispatch(chunkSize);
+        }
+
+        std::vector<uint64_t> nanoseconds;
+        const auto minimumDuration = std::chrono::duration<double>{ minimumSeconds };
+        const auto usageBegin = GetResourceUsage();
+        const auto begin = Clock::now();
+        auto end = begin;
+        while (nanoseconds.size() < MinimumDispatchCount
+               || (end - begin < minimumDuration && nanoseconds.size() < MaximumDispatchCount))
+        {
+            const auto dispatchBegin = Clock::now();
+            design.Dispatch(chunkSize);
+            end = Clock::now();
+            nanoseconds.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - dispatchBegin).count());
+        }
+        const auto usageEnd = GetResourceUsage();
+
+        std::ranges::sort(nanoseconds);
+        return DispatchSummary{ nanoseconds.size(),
+                                std::chrono::duration<double>{ end - begin }.count(),
+                                nanoseconds[nanoseconds.size() / 2],
+                                nanoseconds[std::min(nanoseconds.size() - 1, nanoseconds.size() * 99 / 100)],
+                                ResourceUsage{ usageEnd.CpuSeconds - usageBegin.CpuSeconds,
+                                               usageEnd.VoluntaryContextSwitchCount - usageBegin.VoluntaryContextSwitchCount,
+                                               usageEnd.InvoluntaryContextSwitchCount - usageBegin.InvoluntaryContextSwitchCount } };
+    }
+
+    void PrintSummary(const char* workloadName, const size_t elementCount, const size_t chunkSize, const DispatchSummary& summary)
+    {
+        const auto dispatchCount = static_cast<double>(summary.DispatchCount);
+        std::printf("    %-10s %7zu elems  chunk %4zu%c  %9.2f Melem/s  p50 %9.2f us  p99 %9.2f us"
+                    "  cpu %8.3f ms/dispatch (%5.2f cores)  csw %7.2f vol %7.2f invol /dispatch\n",
+                    workloadName,
+                    elementCount,
+                    chunkSize,
+                    DesignUnderTest::IsChunkSizeFixed ? '*' : ' ',
+                    elementCount * dispatchCount / summary.WallSeconds / 1e6,
+                    summary.P50Nanoseconds / 1e3,
+                    summary.P99Nanoseconds / 1e3,
+                    summary.Usage.CpuSeconds * 1e3 / dispatchCount,
+                    summary.Usage.CpuSeconds / summary.WallSeconds,
+                    summary.Usage.VoluntaryContextSwitchCount / dispatchCount,
+                    summary.Usage.InvoluntaryContextSwitchCount / dispatchCount);
+    }
+
+    void RunBenchmarks(const uint32_t threadCount, const double minimumSeconds, const uint32_t meanIterationCount)
+    {
+        DesignUnderTest design{ threadCount };
+        std::printf("\n=== threads: %u ===\n", threadCount);
+
+        // 분배 지연 시간. 스레드마다 원소 하나씩인 빈 작업이므로, 깨우고 모두 끝났음을 확인하는 왕복 비용만 남음.
+        design.Populate(std::vector<uint32_t>(threadCount, 0));
+        const auto emptyChunkSize = DesignUnderTest::ChunkSizes.front();
+        PrintSummary("empty", threadCount, emptyChunkSize, MeasureDispatches(design, emptyChunkSize, minimumSeconds));
+
+        for (const auto costDistribution : CostDistributions)
+        {
+            for (const auto elementCount : ElementCounts)
+            {
+                design.Populate(MakeIterationCounts(costDistribution, elementCount, meanIterationCount));
+                for (const auto chunkSize : DesignUnderTest::ChunkSizes)
+                {
+                    PrintSummary(GetCostDistributionName(costDistribution),
+                                 elementCount,
+                                 chunkSize,
+                                 MeasureDispatches(design, chunkSize, minimumSeconds));
+                }
+            }
+        }
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    const auto maxThreadCount = argc > 1
+                                ? static_cast<uint32_t>(std::atoi(argv[1]))
+                                : std::max(1u, std::thread::hardware_concurrency());
+    const auto minimumSeconds = argc > 2 ? std::atof(argv[2]) : 0.2;
+    const auto meanIterationCount = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 64u;
+    if (maxThreadCount == 0 || minimumSeconds < 0.0 || meanIterationCount == 0)
+    {
+        std::fprintf(stderr, "usage: %s [max thread count > 0] [seconds per measurement >= 0] [mean iterations per element > 0]\n", argv[0]);
+        return 1;
+    }
+
+#if !defined(EXECUTOR_BENCHMARK_DESIGN_CAS) && !defined(EXECUTOR_BENCHMARK_DESIGN_FETCH_ADD)
+    Core::F_Threads::GetSingleton().RegisterCurrentThread(Core::F_Threads::MainThreadId);
+#endif
+
+    std::printf("design: %s\n", DesignUnderTest::Name);
+    std::printf("hardware threads %u, seed %u, mean %u iterations per element, %.2f s per measurement%s\n",
+                std::thread::hardware_concurrency(),
+                RandomSeed,
+                meanIterationCount,
+                minimumSeconds,
+                DesignUnderTest::IsChunkSizeFixed ? ", * = claim size fixed by the design" : "");
+    for (uint32_t threadCount = 1; threadCount < maxThreadCount; threadCount *= 2)
+    {
+        RunBenchmarks(threadCount, minimumSeconds, meanIterationCount);
+    }
+    RunBenchmarks(maxThreadCount, minimumSeconds, meanIterationCount);
+
+    // 이전 F_SystemManager의 워커들은 멈출 방법이 없으므로 정적 객체 소멸을 건너뛰고 바로 종료함.
+    std::fflush(stdout);
+    std::_Exit(0);
+}
@@ -0,0 +1,11 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_CAS_F_SYSTEMMANAGER_H
+#define BENCH_LEGACYSHIM_CAS_F_SYSTEMMANAGER_H
+
+// CAS_Bad_Cpu.cpp가 이전 엔진에서의 이름으로 포함하는 헤더를 이 저장소의 CAS_Bad_Cpu.h로 연결함.
+#include "../../../CAS_Bad_Cpu.h"
+
+#endif // BENCH_LEGACYSHIM_CAS_F_SYSTEMMANAGER_H
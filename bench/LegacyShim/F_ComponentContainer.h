@@ -0,0 +1,87 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_F_COMPONENTCONTAINER_H
+#define BENCH_LEGACYSHIM_F_COMPONENTCONTAINER_H
+
+#include "F_MemoryPoolManager.h"
+#include "S_System.h"
+#include <new>
+#include <utility>
+
+/**
+ * 이전 엔진의 F_RawComponentContainer 중 F_SystemManager가 사용하는 부분만 둔 것.
+ * 각 블록은 소유 엔티티 바로 뒤에 컴포넌트를 두는 [F_Entity][컴포넌트] 배치이며, FetchAdd_Good_Cpu가 이 배치를 직접 읽음.
+ */
+class F_RawComponentContainer final
+{
+public:
+    class RawConstIterator final
+    {
+    public:
+        RawConstIterator(const F_RawComponentContainer* const container, const F_MemoryPool::const_iterator memoryPoolIterator)
+            : container_{ container },
+              memoryPoolIterator_{ memoryPoolIterator }
+        {
+        }
+
+        [[nodiscard]]
+        bool IsEnd() const
+        {
+            return memoryPoolIterator_.IsEnd();
+        }
+
+        RawConstIterator& operator++()
+        {
+            ++memoryPoolIterator_;
+            return *this;
+        }
+
+        std::pair<F_Entity, const void*> operator*() const
+        {
+            const auto memoryBlockPtr = static_cast<const char*>(*memoryPoolIterator_);
+            return { *reinterpret_cast<const F_Entity*>(memoryBlockPtr), memoryBlockPtr + sizeof(F_Entity) };
+        }
+
+    private:
+        const F_RawComponentContainer* container_;
+        F_MemoryPool::const_iterator memoryPoolIterator_;
+    };
+
+    explicit F_RawComponentContainer(const size_t componentSize)
+        : memoryPool_{ sizeof(F_Entity) + componentSize }
+    {
+    }
+
+    template<typename TComponent>
+    TComponent* CreateComponentFor(const F_Entity entity)
+    {
+        static_assert(alignof(TComponent) <= alignof(F_Entity), "The component must start right after F_Entity.");
+        const auto memoryBlockPtr = static_cast<char*>(memoryPool_.AllocateBlock());
+        new(memoryBlockPtr) F_Entity{ entity };
+        return new(memoryBlockPtr + sizeof(F_Entity)) TComponent{};
+    }
+
+    void Clear()
+    {
+        memoryPool_.Clear();
+    }
+
+    [[nodiscard]]
+    const F_MemoryPool& GetMemoryPool() const
+    {
+        return memoryPool_;
+    }
+
+    [[nodiscard]]
+    RawConstIterator GetBeginConstIterator() const
+    {
+        return RawConstIterator{ this, memoryPool_.begin() };
+    }
+
+private:
+    F_MemoryPool memoryPool_;
+};
+
+#endif // BENCH_LEGACYSHIM_F_COMPONENTCONTAINER_H
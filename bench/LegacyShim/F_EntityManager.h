@@ -0,0 +1,86 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_F_ENTITYMANAGER_H
+#define BENCH_LEGACYSHIM_F_ENTITYMANAGER_H
+
+#include "F_ComponentContainer.h"
+#include "F_Map.h"
+#include <cstdint>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+/**
+ * 이전 엔진의 F_EntityManager 중 F_SystemManager가 사용하는 부분과, 벤치마크가 데이터를 채우기 위한 함수만 둔 것.
+ * 컴포넌트 타입마다 F_RawComponentContainer 하나에 저장하며, 전역 객체는 빈 F_Map 하나뿐임.
+ */
+class F_EntityManager final
+{
+public:
+    F_Entity CreateEntity()
+    {
+        return F_Entity{ nextEntityId_++ };
+    }
+
+    template<typename TComponent>
+    TComponent* CreateComponentFor(const F_Entity entity)
+    {
+        auto& rawComponentContainer = rawComponentContainers_[typeid(TComponent)];
+        if (!rawComponentContainer)
+        {
+            rawComponentContainer = std::make_unique<F_RawComponentContainer>(sizeof(TComponent));
+        }
+
+        return rawComponentContainer->CreateComponentFor<TComponent>(entity);
+    }
+
+    /**
+     * 모든 컴포넌트를 지움. 컨테이너 자체는 남겨 두므로 F_SystemManager가 받아 둔 메모리 풀 주소는 그대로 유효함.
+     */
+    void ClearComponents()
+    {
+        for (auto& rawComponentContainerKv : rawComponentContainers_)
+        {
+            rawComponentContainerKv.second->Clear();
+        }
+        nextEntityId_ = 0;
+    }
+
+    F_RawComponentContainer* GetRawComponentContainer(const std::type_index componentTypeIndex)
+    {
+        const auto iterator = rawComponentContainers_.find(componentTypeIndex);
+        return iterator == rawComponentContainers_.end() ? nullptr : iterator->second.get();
+    }
+
+    F_RawComponentContainer::RawConstIterator GetRawComponentBeginConstIterator(const std::type_index componentTypeIndex) const
+    {
+        const auto iterator = rawComponentContainers_.find(componentTypeIndex);
+        if (iterator == rawComponentContainers_.end())
+        {
+            return F_RawComponentContainer::RawConstIterator{ nullptr, F_MemoryPool::const_iterator{ nullptr, 0, 0 } };
+        }
+
+        return iterator->second->GetBeginConstIterator();
+    }
+
+    template<typename TGlobalObject>
+    TGlobalObject* GetGlobalObject(uint64_t)
+    {
+        return &map_;
+    }
+
+    template<typename TGlobalObject>
+    const TGlobalObject* GetGlobalObject(uint64_t) const
+    {
+        return &map_;
+    }
+
+private:
+    std::unordered_map<std::type_index, std::unique_ptr<F_RawComponentContainer>> rawComponentContainers_;
+    F_Map map_;
+    uint32_t nextEntityId_ = 0;
+};
+
+#endif // BENCH_LEGACYSHIM_F_ENTITYMANAGER_H
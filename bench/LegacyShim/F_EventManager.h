@@ -0,0 +1,15 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_F_EVENTMANAGER_H
+#define BENCH_LEGACYSHIM_F_EVENTMANAGER_H
+
+/**
+ * F_SystemManager는 참조를 시스템 함수에 넘기기만 하므로 빈 클래스로 충분함.
+ */
+class F_EventManager final
+{
+};
+
+#endif // BENCH_LEGACYSHIM_F_EVENTMANAGER_H
@@ -0,0 +1,15 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_F_MAP_H
+#define BENCH_LEGACYSHIM_F_MAP_H
+
+/**
+ * F_SystemManager가 스레드마다 F_Pathfinder를 만들 때 넘기는 전역 맵. 벤치마크의 시스템은 길찾기를 하지 않으므로 비어 있음.
+ */
+struct F_Map final
+{
+};
+
+#endif // BENCH_LEGACYSHIM_F_MAP_H
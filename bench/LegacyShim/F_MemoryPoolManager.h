@@ -0,0 +1,110 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_F_MEMORYPOOLMANAGER_H
+#define BENCH_LEGACYSHIM_F_MEMORYPOOLMANAGER_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * 이전 엔진의 F_MemoryPool 중 F_SystemManager가 사용하는 부분만 둔 것. 고정 크기 블록을 페이지 단위로 할당하며,
+ * 블록은 앞에서부터 빈틈없이 채워지므로 [0, 할당한 블록 수) 밖의 Index에는 nullptr을 돌려줌.
+ */
+class F_MemoryPool final
+{
+public:
+    static constexpr size_t BlocksPerPage = 64;
+
+    /**
+     * 블록을 차례로 방문하는 반복자. CAS_Bad_Cpu는 이것을 std::atomic에 넣어 CAS하므로 trivially copyable이어야 함.
+     */
+    class const_iterator final
+    {
+    public:
+        const_iterator(const F_MemoryPool* const memoryPool, const size_t pageIndex, const size_t blockIndexInPage)
+            : memoryPool_{ memoryPool },
+              blockIndex_{ pageIndex * BlocksPerPage + blockIndexInPage }
+        {
+        }
+
+        [[nodiscard]]
+        bool IsEnd() const
+        {
+            return memoryPool_ == nullptr || blockIndex_ >= memoryPool_->blockCount_;
+        }
+
+        const_iterator& operator++()
+        {
+            ++blockIndex_;
+            return *this;
+        }
+
+        const void* operator*() const
+        {
+            return memoryPool_->GetMemoryBlockByIndex(blockIndex_);
+        }
+
+    private:
+        const F_MemoryPool* memoryPool_;
+        size_t blockIndex_;
+    };
+
+    explicit F_MemoryPool(const size_t blockSize)
+        : blockSize_{ blockSize },
+          blockCount_{ 0 }
+    {
+    }
+
+    F_MemoryPool(const F_MemoryPool&) = delete;
+
+    F_MemoryPool& operator=(const F_MemoryPool&) = delete;
+
+    void* AllocateBlock()
+    {
+        if (blockCount_ == pages_.size() * BlocksPerPage)
+        {
+            pages_.push_back(std::make_unique<std::byte[]>(blockSize_ * BlocksPerPage));
+        }
+
+        const auto blockIndex = blockCount_++;
+        return pages_[blockIndex / BlocksPerPage].get() + blockIndex % BlocksPerPage * blockSize_;
+    }
+
+    void Clear()
+    {
+        blockCount_ = 0;
+    }
+
+    [[nodiscard]]
+    size_t GetPageCount() const
+    {
+        return (blockCount_ + BlocksPerPage - 1) / BlocksPerPage;
+    }
+
+    [[nodiscard]]
+    const void* GetMemoryBlockByIndex(const size_t blockIndex) const
+    {
+        if (blockIndex >= blockCount_)
+        {
+            return nullptr;
+        }
+
+        return pages_[blockIndex / BlocksPerPage].get() + blockIndex % BlocksPerPage * blockSize_;
+    }
+
+    [[nodiscard]]
+    const_iterator begin() const
+    {
+        return const_iterator{ this, 0, 0 };
+    }
+
+private:
+    std::vector<std::unique_ptr<std::byte[]>> pages_;
+    const size_t blockSize_;
+    size_t blockCount_;
+};
+
+#endif // BENCH_LEGACYSHIM_F_MEMORYPOOLMANAGER_H
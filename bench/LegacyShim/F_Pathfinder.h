@@ -0,0 +1,26 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_F_PATHFINDER_H
+#define BENCH_LEGACYSHIM_F_PATHFINDER_H
+
+#include "F_Map.h"
+
+/**
+ * 이전 엔진의 스레드별 길찾기 객체. 생성 인자만 맞춘 것.
+ */
+class F_Pathfinder final
+{
+public:
+    F_Pathfinder(const F_Map& mapRef, const int threadId)
+        : MapRef{ mapRef },
+          ThreadId{ threadId }
+    {
+    }
+
+    const F_Map& MapRef;
+    const int ThreadId;
+};
+
+#endif // BENCH_LEGACYSHIM_F_PATHFINDER_H
@@ -0,0 +1,11 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_FETCHADD_F_SYSTEMMANAGER_H
+#define BENCH_LEGACYSHIM_FETCHADD_F_SYSTEMMANAGER_H
+
+// FetchAdd_Good_Cpu.cpp가 이전 엔진에서의 이름으로 포함하는 헤더를 이 저장소의 FetchAdd_Good_Cpu.h로 연결함.
+#include "../../../FetchAdd_Good_Cpu.h"
+
+#endif // BENCH_LEGACYSHIM_FETCHADD_F_SYSTEMMANAGER_H
@@ -0,0 +1,112 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_S_SYSTEM_H
+#define BENCH_LEGACYSHIM_S_SYSTEM_H
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <typeindex>
+
+/**
+ * 이전 엔진의 S_System.h 중 CAS_Bad_Cpu와 FetchAdd_Good_Cpu의 F_SystemManager가 사용하는 부분만 둔 것.
+ * 시스템 함수들이 받는 매개 변수 구조체와 시스템 등록에 쓰이는 Blueprint, concept를 정의함.
+ */
+
+#define ERR_FAIL_COND(condition)                                                            \
+    do                                                                                      \
+    {                                                                                       \
+        if (condition)                                                                      \
+        {                                                                                   \
+            std::fprintf(stderr, "%s:%d: condition \"%s\" is true.\n", __FILE__, __LINE__, #condition); \
+            return;                                                                         \
+        }                                                                                   \
+    } while (false)
+
+class F_EntityManager;
+
+class F_EventManager;
+
+class F_Pathfinder;
+
+struct F_Entity
+{
+    uint32_t Id;
+};
+
+struct F_RevisionDataNode
+{
+    F_RevisionDataNode* Next;
+};
+
+struct F_RevisionDataWriteContext
+{
+    std::atomic<F_RevisionDataNode*>& FirstNode;
+};
+
+struct F_RevisionDataReadContext
+{
+    std::atomic<F_RevisionDataNode*>& FirstNode;
+};
+
+struct F_ProcessParams
+{
+    const void* AxisComponentPtr;
+    F_Entity Entity;
+    F_RevisionDataWriteContext RevisionDataWriteContext;
+    F_Pathfinder& Pathfinder;
+    F_EntityManager& EntityManager;
+    double DeltaTime;
+    uint64_t DeltaTicks;
+    uint64_t CurrentTick;
+};
+
+struct F_ApplyParams
+{
+    F_RevisionDataReadContext RevisionDataReadContext;
+    F_EntityManager& EntityManager;
+    F_EventManager& EventManager;
+    F_Pathfinder& Pathfinder;
+    double DeltaTime;
+    uint64_t DeltaTicks;
+    uint64_t CurrentTick;
+};
+
+struct F_ProcessAndApplyParams
+{
+    F_EntityManager& EntityManager;
+    F_EventManager& EventManager;
+    double DeltaTime;
+    uint64_t DeltaTicks;
+    uint64_t CurrentTick;
+};
+
+using ProcessFunction = void (*)(const F_ProcessParams&);
+
+using ApplyFunction = void (*)(const F_ApplyParams&);
+
+using ReleaseRevisionDataNodeFunction = void (*)(std::atomic<F_RevisionDataNode*>&);
+
+struct F_SingleThreadSystemBlueprint
+{
+    void (*ProcessAndApplyFunction)(const F_ProcessAndApplyParams&);
+};
+
+struct F_MultiThreadSystemBlueprint
+{
+    std::type_index AxisComponentTypeIndex;
+    ::ProcessFunction ProcessFunction;
+    ::ApplyFunction ApplyFunction;
+    ::ReleaseRevisionDataNodeFunction ReleaseRevisionDataNodeFunction;
+};
+
+template<typename T>
+concept IsSingleThreadSystem = requires { { T::SingleThreadSystemBlueprint } -> std::convertible_to<const F_SingleThreadSystemBlueprint&>; };
+
+template<typename T>
+concept IsMultiThreadSystem = requires { { T::MultiThreadSystemBlueprint } -> std::convertible_to<const F_MultiThreadSystemBlueprint&>; };
+
+#endif // BENCH_LEGACYSHIM_S_SYSTEM_H
@@ -0,0 +1,24 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_U_HASH_H
+#define BENCH_LEGACYSHIM_U_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 이전 엔진의 문자열 해시 리터럴. 전역 객체가 F_Map 하나뿐이므로 FNV-1a로 충분함.
+ */
+constexpr uint64_t operator""_h(const char* const string, const size_t length)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t index = 0; index < length; ++index)
+    {
+        hash = (hash ^ static_cast<unsigned char>(string[index])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+#endif // BENCH_LEGACYSHIM_U_HASH_H
@@ -0,0 +1,18 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+#ifndef BENCH_LEGACYSHIM_U_THREADINFO_H
+#define BENCH_LEGACYSHIM_U_THREADINFO_H
+
+/**
+ * 이전 엔진의 스레드 번호 등록. 벤치마크의 시스템은 스레드 번호를 쓰지 않으므로 아무 일도 하지 않음.
+ */
+struct U_ThreadInfo final
+{
+    static void RegisterCurrentThread(int)
+    {
+    }
+};
+
+#endif // BENCH_LEGACYSHIM_U_THREADINFO_H
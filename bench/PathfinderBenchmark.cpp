@@ -0,0 +1,566 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+// G_Pathfinder 벤치마크. 고정 시드로 만든 맵들(개활지, 미로, 방과 복도, 잡음 비용)과 질의 집합에 대해
+// Pathfind(), CanReach(), ProcessPathRequests(), Process()의 지연 시간(p50/p99)과 처리량을 워커 없는 F_Executor와
+// 워커가 있는 F_Executor에서 각각 측정하고, Dijkstra 기준 경로 비용과 비교하여 경로 품질과 도달 가능 여부의 정확성을 확인함.
+// 사용법: PathfinderBenchmark [맵 크기 = 256] [질의 수 = 256] [워커 수 = 하드웨어 스레드 수 - 1]
+
+#include "F_ConnectivityIndex.h"
+#include "F_Executor.h"
+#include "F_Threads.h"
+#include "G_Pathfinder.h"
+
+#include <godot_cpp/variant/vector2i.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+using namespace godot;
+
+namespace
+{
+    constexpr uint32_t RandomSeed = 20261018;
+    constexpr uint32_t UnreachableCost = std::numeric_limits<uint32_t>::max();
+
+    struct BenchmarkMap final
+    {
+        std::string Name;
+        U_TiledDatas<uint32_t> CostDatas;
+    };
+
+    struct Query final
+    {
+        Vector2i From;
+        Vector2i To;
+        uint32_t ReferenceCost; // Dijkstra로 구한 최소 비용. 도달할 수 없으면 UnreachableCost.
+    };
+
+    struct LatencySummary final
+    {
+        uint64_t P50Nanoseconds;
+        uint64_t P99Nanoseconds;
+        uint64_t MaxNanoseconds;
+        double TotalMilliseconds;
+    };
+
+    /**
+     * 경로 품질. 경로 비용은 G_Pathfinder와 같은 이동 비용(직선 10, 대각선 14)으로 계산함.
+     */
+    struct QualitySummary final
+    {
+        uint32_t FoundMismatchCount; // 경로를 찾았는지가 Dijkstra의 도달 가능 여부와 다른 질의 수.
+        uint32_t SuboptimalCount;
+        double MeanCostRatio; // 찾은 경로들의 (경로 비용 / 최소 비용) 평균.
+        double MaxCostRatio;
+    };
+
+    bool IsPassable(const U_TiledDatas<uint32_t>& costDatas, const Vector2i& position)
+    {
+        const auto cost = costDatas.TryGetDataAt(position);
+        return cost && *cost != G_Pathfinder::ImpassableCost;
+    }
+
+    uint32_t GetStepCost(const Vector2i& from, const Vector2i& to)
+    {
+        return from.x != to.x && from.y != to.y ? 14 : 10;
+    }
+
+    BenchmarkMap MakeOpenField(const Vector2i& mapSize)
+    {
+        BenchmarkMap map{ "open field", {} };
+        map.CostDatas.Resize(mapSize, 1);
+        return map;
+    }
+
+    /**
+     * 홀수 좌표의 칸들을 방으로 하는 깊이 우선 미로. 짝수 좌표는 벽이며, 탐색한 방향의 벽만 뚫음.
+     */
+    BenchmarkMap MakeMaze(const Vector2i& mapSize, std::mt19937& random)
+    {
+        BenchmarkMap map{ "maze", {} };
+        map.CostDatas.Resize(mapSize, G_Pathfinder::ImpassableCost);
+
+        const auto cellCountX = (mapSize.x - 1) / 2;
+        const auto cellCountY = (mapSize.y - 1) / 2;
+        std::vector<bool> visited(static_cast<size_t>(cellCountX) * cellCountY, false);
+        std::vector<Vector2i> stack{ Vector2i{ 0, 0 } };
+        visited[0] = true;
+        map.CostDatas.GetDataAt(Vector2i{ 1, 1 }) = 1;
+        while (!stack.empty())
+        {
+            const auto cell = stack.back();
+            std::array<Vector2i, 4> nearCells;
+            size_t nearCellCount = 0;
+            for (const auto& offset : { Vector2i{ 1, 0 }, Vector2i{ -1, 0 }, Vector2i{ 0, 1 }, Vector2i{ 0, -1 } })
+            {
+                const auto nearCell = cell + offset;
+                if (nearCell.x >= 0 && nearCell.y >= 0 && nearCell.x < cellCountX && nearCell.y < cellCountY
+                    && !visited[static_cast<size_t>(nearCell.y) * cellCountX + nearCell.x])
+                {
+                    nearCells[nearCellCount++] = nearCell;
+                }
+            }
+            if (nearCellCount == 0)
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            const auto nearCell = nearCells[std::uniform_int_distribution<size_t>{ 0, nearCellCount - 1 }(random)];
+            visited[static_cast<size_t>(nearCell.y) * cellCountX + nearCell.x] = true;
+            map.CostDatas.GetDataAt(Vector2i{ cell.x + nearCell.x + 1, cell.y + nearCell.y + 1 }) = 1;
+            map.CostDatas.GetDataAt(Vector2i{ nearCell.x * 2 + 1, nearCell.y * 2 + 1 }) = 1;
+            stack.push_back(nearCell);
+        }
+        return map;
+    }
+
+    /**
+     * 무작위 크기의 방들을 파고, 만든 순서대로 이웃한 방의 중심끼리 ㄱ자 복도로 이음.
+     */
+    BenchmarkMap MakeRoomsAndCorridors(const Vector2i& mapSize, std::mt19937& random)
+    {
+        BenchmarkMap map{ "rooms and corridors", {} };
+        map.CostDatas.Resize(mapSize, G_Pathfinder::ImpassableCost);
+
+        const auto carve = [&map](const Vector2i& position)
+        {
+            if (const auto cost = map.CostDatas.TryGetDataAt(position))
+            {
+                *cost = 1;
+            }
+        };
+
+        const auto roomCount = std::max(2, mapSize.x * mapSize.y / 1024);
+        std::uniform_int_distribution<int32_t> roomSizeDistribution{ 4, 16 };
+        Vector2i previousCenter{};
+        for (int32_t roomIndex = 0; roomIndex < roomCount; ++roomIndex)
+        {
+            const Vector2i roomSize{ roomSizeDistribution(random), roomSizeDistribution(random) };
+            const Vector2i roomPosition{ std::uniform_int_distribution<int32_t>{ 1, std::max(1, mapSize.x - roomSize.x - 1) }(random),
+                                         std::uniform_int_distribution<int32_t>{ 1, std::max(1, mapSize.y - roomSize.y - 1) }(random) };
+            for (auto y = roomPosition.y; y < roomPosition.y + roomSize.y; ++y)
+            {
+                for (auto x = roomPosition.x; x < roomPosition.x + roomSize.x; ++x)
+                {
+                    carve(Vector2i{ x, y });
+                }
+            }
+
+            const Vector2i center{ roomPosition.x + roomSize.x / 2, roomPosition.y + roomSize.y / 2 };
+            if (roomIndex > 0)
+            {
+                for (auto x = std::min(previousCenter.x, center.x); x <= std::max(previousCenter.x, center.x); ++x)
+                {
+                    carve(Vector2i{ x, previousCenter.y });
+                }
+                for (auto y = std::min(previousCenter.y, center.y); y <= std::max(previousCenter.y, center.y); ++y)
+                {
+                    carve(Vector2i{ center.x, y });
+                }
+            }
+            previousCenter = center;
+        }
+        return map;
+    }
+
+    /**
+     * 타일마다 1~9의 비용과 20%의 통행 불가 타일. 현재 G_Pathfinder는 통행 불가 여부만 반영하므로, 통행 가능한 타일의 비용은
+     * 비용 기반 탐색으로 바꾼 뒤의 비교를 위한 것이며 지금은 흩어진 장애물 맵으로 동작함.
+     */
+    BenchmarkMap MakeNoisyCosts(const Vector2i& mapSize, std::mt19937& random)
+    {
+        BenchmarkMap map{ "noisy costs", {} };
+        map.CostDatas.Resize(mapSize, 1);
+        std::uniform_int_distribution<uint32_t> costDistribution{ 1, 9 };
+        std::bernoulli_distribution impassableDistribution{ 0.2 };
+        for (int32_t y = 0; y < mapSize.y; ++y)
+        {
+            for (int32_t x = 0; x < mapSize.x; ++x)
+            {
+                const auto cost = costDistribution(random);
+                map.CostDatas.GetDataAt(Vector2i{ x, y }) = impassableDistribution(random) ? G_Pathfinder::ImpassableCost : cost;
+            }
+        }
+        return map;
+    }
+
+    /**
+     * from에서 to까지의 최소 비용. G_Pathfinder와 같이 8방향으로 이동하며 통행 불가 타일만 피함.
+     */
+    uint32_t FindReferenceCost(const U_TiledDatas<uint32_t>& costDatas,
+                               const Vector2i& from,
+                               const Vector2i& to,
+                               std::vector<uint32_t>& distances)
+    {
+        const auto mapSize = costDatas.GetSize();
+        distances.assign(static_cast<size_t>(mapSize.x) * mapSize.y, UnreachableCost);
+        const auto getTileIndex = [&mapSize](const Vector2i& position)
+        {
+            return static_cast<size_t>(position.y) * mapSize.x + position.x;
+        };
+
+        using QueueNode = std::pair<uint32_t, size_t>;
+        std::priority_queue<QueueNode, std::vector<QueueNode>, std::greater<>> queue;
+        distances[getTileIndex(from)] = 0;
+        queue.emplace(0, getTileIndex(from));
+        while (!queue.empty())
+        {
+            const auto [distance, tileIndex] = queue.top();
+            queue.pop();
+            const Vector2i position{ static_cast<int32_t>(tileIndex % mapSize.x), static_cast<int32_t>(tileIndex / mapSize.x) };
+            if (distance != distances[tileIndex])
+            {
+                continue;
+            }
+            if (position == to)
+            {
+                return distance;
+            }
+
+            for (const auto& [offsetX, offsetY] : M_Pathfind::DirectionOffsets)
+            {
+                const auto nearPosition = position + Vector2i{ offsetX, offsetY };
+                if (!IsPassable(costDatas, nearPosition))
+                {
+                    continue;
+                }
+
+                const auto nearDistance = distance + GetStepCost(position, nearPosition);
+                auto& nearTileDistance = distances[getTileIndex(nearPosition)];
+                if (nearDistance < nearTileDistance)
+                {
+                    nearTileDistance = nearDistance;
+                    queue.emplace(nearDistance, getTileIndex(nearPosition));
+                }
+            }
+        }
+        return UnreachableCost;
+    }
+
+    std::vector<Query> MakeQueries(const U_TiledDatas<uint32_t>& costDatas, const uint32_t queryCount, std::mt19937& random)
+    {
+        const auto mapSize = costDatas.GetSize();
+        std::vector<Vector2i> passablePositions;
+        for (int32_t y = 0; y < mapSize.y; ++y)
+        {
+            for (int32_t x = 0; x < mapSize.x; ++x)
+            {
+                if (IsPassable(costDatas, Vector2i{ x, y }))
+                {
+                    passablePositions.emplace_back(x, y);
+                }
+            }
+        }
+
+        std::vector<Query> queries;
+        std::vector<uint32_t> distances;
+        std::uniform_int_distribution<size_t> positionDistribution{ 0, passablePositions.size() - 1 };
+        for (uint32_t queryIndex = 0; queryIndex < queryCount; ++queryIndex)
+        {
+            const auto from = passablePositions[positionDistribution(random)];
+            const auto to = passablePositions[positionDistribution(random)];
+            queries.push_back(Query{ from, to, FindReferenceCost(costDatas, from, to, distances) });
+        }
+        return queries;
+    }
+
+    LatencySummary Summarize(std::vector<uint64_t>& nanoseconds, const double totalMilliseconds)
+    {
+        if (nanoseconds.empty())
+        {
+            return LatencySummary{ 0, 0, 0, totalMilliseconds };
+        }
+
+        std::ranges::sort(nanoseconds);
+        const auto getPercentile = [&nanoseconds](const double percentile)
+        {
+            return nanoseconds[std::min(nanoseconds.size() - 1, static_cast<size_t>(static_cast<double>(nanoseconds.size()) * percentile))];
+        };
+        return LatencySummary{ getPercentile(0.5), getPercentile(0.99), nanoseconds.back(), totalMilliseconds };
+    }
+
+    uint64_t GetElapsedNanoseconds(const std::chrono::steady_clock::time_point beginTime)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+    }
+
+    double GetElapsedMilliseconds(const std::chrono::steady_clock::time_point beginTime)
+    {
+        return static_cast<double>(GetElapsedNanoseconds(beginTime)) / 1e6;
+    }
+
+    /**
+     * 경로를 끝까지 진행시키며 비용을 합산. 경로가 없으면 UnreachableCost.
+     */
+    uint32_t ConsumePathCost(G_Pathfinder& pathfinder, const M_Pathfind::PathHandle pathHandle, const Vector2i& from, const uint64_t worldTick)
+    {
+        auto pathContext = pathfinder.GetPathContext(pathHandle, worldTick);
+        if (!pathContext || !pathContext->Current)
+        {
+            return UnreachableCost;
+        }
+
+        uint32_t pathCost = 0;
+        auto previousPosition = from;
+        for (; pathContext && pathContext->Current; pathContext = pathfinder.GetPathContext(pathHandle, worldTick))
+        {
+            if (*pathContext->Current != previousPosition)
+            {
+                pathCost += GetStepCost(previousPosition, *pathContext->Current);
+                previousPosition = *pathContext->Current;
+            }
+            pathfinder.AdvancePath(pathHandle, worldTick);
+        }
+        return pathCost;
+    }
+
+    QualitySummary CheckQuality(const std::vector<Query>& queries, const std::vector<uint32_t>& pathCosts)
+    {
+        QualitySummary qualitySummary{ 0, 0, 0.0, 1.0 };
+        uint32_t foundCount = 0;
+        for (size_t queryIndex = 0; queryIndex < queries.size(); ++queryIndex)
+        {
+            const auto referenceCost = queries[queryIndex].ReferenceCost;
+            const auto pathCost = pathCosts[queryIndex];
+            if ((referenceCost == UnreachableCost) != (pathCost == UnreachableCost))
+            {
+                qualitySummary.FoundMismatchCount += 1;
+                continue;
+            }
+            if (pathCost == UnreachableCost)
+            {
+                continue;
+            }
+
+            const auto costRatio = referenceCost == 0 ? 1.0 : static_cast<double>(pathCost) / referenceCost;
+            qualitySummary.SuboptimalCount += pathCost > referenceCost ? 1 : 0;
+            qualitySummary.MeanCostRatio += costRatio;
+            qualitySummary.MaxCostRatio = std::max(qualitySummary.MaxCostRatio, costRatio);
+            foundCount += 1;
+        }
+        qualitySummary.MeanCostRatio = foundCount > 0 ? qualitySummary.MeanCostRatio / foundCount : 1.0;
+        return qualitySummary;
+    }
+
+    void PrintLatency(const char* operationName, const LatencySummary& latencySummary, const size_t operationCount)
+    {
+        std::printf("    %-20s p50 %9.2f us  p99 %9.2f us  max %9.2f us  total %9.2f ms  %10.0f ops/s\n",
+                    operationName,
+                    static_cast<double>(latencySummary.P50Nanoseconds) / 1e3,
+                    static_cast<double>(latencySummary.P99Nanoseconds) / 1e3,
+                    static_cast<double>(latencySummary.MaxNanoseconds) / 1e3,
+                    latencySummary.TotalMilliseconds,
+                    latencySummary.TotalMilliseconds > 0.0 ? static_cast<double>(operationCount) / (latencySummary.TotalMilliseconds / 1e3) : 0.0);
+    }
+
+    void PrintQuality(const char* operationName, const QualitySummary& qualitySummary)
+    {
+        std::printf("    %-20s found mismatch %u  suboptimal %u  mean cost ratio %.4f  max cost ratio %.4f\n",
+                    operationName,
+                    qualitySummary.FoundMismatchCount,
+                    qualitySummary.SuboptimalCount,
+                    qualitySummary.MeanCostRatio,
+                    qualitySummary.MaxCostRatio);
+    }
+
+    /**
+     * 질의 하나를 블록 하나로 하여 메인 스레드와 워커들이 나누어 Pathfind()를 수행. 워커가 없으면 메인 스레드가 모두 수행함.
+     */
+    void RunPathfind(const F_MutableContext& context, const BenchmarkMap& map, const std::vector<Query>& queries)
+    {
+        G_Pathfinder pathfinder;
+        pathfinder.WarmUp(context, map.CostDatas.GetSize());
+
+        std::vector<M_Pathfind::PathHandle> pathHandles(queries.size());
+        std::vector<uint64_t> nanoseconds(queries.size());
+        const auto beginTime = std::chrono::steady_clock::now();
+        context.Executor.ForEachBlock(context,
+                                      queries.size(),
+                                      [&pathfinder, &map, &queries, &pathHandles, &nanoseconds](const size_t queryIndex)
+                                      {
+                                          const auto queryBeginTime = std::chrono::steady_clock::now();
+                                          pathHandles[queryIndex] = pathfinder.Pathfind(map.CostDatas, queries[queryIndex].From, queries[queryIndex].To);
+                                          nanoseconds[queryIndex] = GetElapsedNanoseconds(queryBeginTime);
+                                      });
+        const auto latencySummary = Summarize(nanoseconds, GetElapsedMilliseconds(beginTime));
+
+        std::vector<uint32_t> pathCosts(queries.size());
+        for (size_t queryIndex = 0; queryIndex < queries.size(); ++queryIndex)
+        {
+            pathCosts[queryIndex] = ConsumePathCost(pathfinder, pathHandles[queryIndex], queries[queryIndex].From, context.WorldCurrentTick);
+        }
+        PrintLatency("Pathfind", latencySummary, queries.size());
+        PrintQuality("Pathfind", CheckQuality(queries, pathCosts));
+    }
+
+    void RunCanReach(const F_MutableContext& context, const BenchmarkMap& map, const std::vector<Query>& queries)
+    {
+        G_Pathfinder pathfinder;
+        F_ConnectivityIndex connectivityIndex;
+        const auto buildBeginTime = std::chrono::steady_clock::now();
+        connectivityIndex.Build(context, map.CostDatas);
+        const auto buildMilliseconds = GetElapsedMilliseconds(buildBeginTime);
+
+        // 한 번의 질의는 수십 나노초 수준이라 시계를 읽는 비용이 더 크므로, 질의를 묶음 단위로 측정하여 질의당 시간으로 환산함.
+        constexpr size_t QueriesPerSample = 64;
+        constexpr size_t RepeatCount = 64;
+        std::vector<uint32_t> reachableCounts(RepeatCount); // 질의 결과를 버리면 컴파일러가 질의를 없앨 수 있으므로 저장해 둠.
+        std::vector<uint64_t> nanoseconds(RepeatCount);
+        const auto beginTime = std::chrono::steady_clock::now();
+        context.Executor.ForEachBlock(context,
+                                      RepeatCount,
+                                      [&pathfinder, &connectivityIndex, &queries, &reachableCounts, &nanoseconds](const size_t repeatIndex)
+                                      {
+                                          const auto sampleBeginTime = std::chrono::steady_clock::now();
+                                          uint32_t reachableCount = 0;
+                                          for (size_t sampleIndex = 0; sampleIndex < QueriesPerSample; ++sampleIndex)
+                                          {
+                                              const auto& query = queries[(repeatIndex * QueriesPerSample + sampleIndex) % queries.size()];
+                                              reachableCount += pathfinder.CanReach(connectivityIndex, query.From, query.To) ? 1 : 0;
+                                          }
+                                          nanoseconds[repeatIndex] = GetElapsedNanoseconds(sampleBeginTime) / QueriesPerSample;
+                                          reachableCounts[repeatIndex] = reachableCount;
+                                      });
+        const auto latencySummary = Summarize(nanoseconds, GetElapsedMilliseconds(beginTime));
+
+        uint32_t mismatchCount = 0;
+        for (const auto& query : queries)
+        {
+            const auto isReachable = pathfinder.CanReach(connectivityIndex, query.From, query.To);
+            mismatchCount += isReachable != (query.ReferenceCost != UnreachableCost) ? 1 : 0;
+        }
+        PrintLatency("CanReach", latencySummary, QueriesPerSample * RepeatCount);
+        std::printf("    %-20s build %.2f ms  reachability mismatch %u\n", "CanReach", buildMilliseconds, mismatchCount);
+    }
+
+    /**
+     * 모든 질의를 RequestPathfind()로 요청한 후 모두 끝날 때까지 ProcessPathRequests()를 틱마다 호출하고, 그 후 경로들이 만료될 때까지
+     * Process()를 틱마다 호출함. 지연 시간은 호출 한 번의 시간.
+     */
+    void RunProcess(const F_MutableContext& context, const BenchmarkMap& map, const std::vector<Query>& queries)
+    {
+        constexpr auto TimeBudget = std::chrono::milliseconds{ 2 };
+        G_Pathfinder pathfinder;
+        pathfinder.WarmUp(context, map.CostDatas.GetSize());
+        auto tickContext = context;
+
+        std::vector<M_Pathfind::PathHandle> pathHandles;
+        for (const auto& query : queries)
+        {
+            pathHandles.push_back(pathfinder.RequestPathfind(query.From, query.To, 0));
+        }
+
+        std::vector<uint64_t> nanoseconds;
+        const auto beginTime = std::chrono::steady_clock::now();
+        const auto isPending = [&pathfinder, &tickContext](const M_Pathfind::PathHandle pathHandle)
+        {
+            const auto pathContext = pathfinder.GetPathContext(pathHandle, tickContext.WorldCurrentTick);
+            return pathContext && pathContext->IsPending;
+        };
+        while (std::ranges::any_of(pathHandles, isPending))
+        {
+            const auto callBeginTime = std::chrono::steady_clock::now();
+            pathfinder.ProcessPathRequests(tickContext, map.CostDatas, TimeBudget);
+            nanoseconds.push_back(GetElapsedNanoseconds(callBeginTime));
+            tickContext.WorldCurrentTick += 1;
+        }
+        const auto processPathRequestsSummary = Summarize(nanoseconds, GetElapsedMilliseconds(beginTime));
+        const auto tickCount = nanoseconds.size();
+
+        std::vector<uint32_t> pathCosts(queries.size());
+        for (size_t queryIndex = 0; queryIndex < queries.size(); ++queryIndex)
+        {
+            pathCosts[queryIndex] = ConsumePathCost(pathfinder, pathHandles[queryIndex], queries[queryIndex].From, tickContext.WorldCurrentTick);
+        }
+
+        nanoseconds.clear();
+        const auto processBeginTime = std::chrono::steady_clock::now();
+        for (uint32_t tick = 0; tick < 4 * M_Pathfind::PathEntryRefreshIntervalWorldTick; ++tick)
+        {
+            const auto callBeginTime = std::chrono::steady_clock::now();
+            pathfinder.Process(tickContext);
+            nanoseconds.push_back(GetElapsedNanoseconds(callBeginTime));
+            tickContext.WorldCurrentTick += 1;
+        }
+        const auto processSummary = Summarize(nanoseconds, GetElapsedMilliseconds(processBeginTime));
+
+        PrintLatency("ProcessPathRequests", processPathRequestsSummary, queries.size());
+        std::printf("    %-20s %zu ticks for %zu requests\n", "ProcessPathRequests", tickCount, queries.size());
+        PrintQuality("ProcessPathRequests", CheckQuality(queries, pathCosts));
+        PrintLatency("Process", processSummary, nanoseconds.size());
+    }
+
+    void RunBenchmarks(const uint32_t workerThreadCount, const std::vector<BenchmarkMap>& maps, const std::vector<std::vector<Query>>& queries)
+    {
+        F_Executor executor{ workerThreadCount };
+        F_EntityManager entityManager;
+        F_EventManager eventManager;
+        const F_MutableContext context{ entityManager, eventManager, executor, 1 };
+
+        std::printf("\n=== worker threads: %u ===\n", workerThreadCount);
+        for (size_t mapIndex = 0; mapIndex < maps.size(); ++mapIndex)
+        {
+            std::printf("  [%s]\n", maps[mapIndex].Name.c_str());
+            RunPathfind(context, maps[mapIndex], queries[mapIndex]);
+            RunCanReach(context, maps[mapIndex], queries[mapIndex]);
+            RunProcess(context, maps[mapIndex], queries[mapIndex]);
+        }
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    const auto mapExtent = argc > 1 ? std::atoi(argv[1]) : 256;
+    const auto queryCount = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 256u;
+    const auto workerThreadCount = argc > 3
+                                   ? static_cast<uint32_t>(std::atoi(argv[3]))
+                                   : std::max(1u, std::thread::hardware_concurrency()) - 1;
+    if (mapExtent < 8 || mapExtent > std::numeric_limits<uint16_t>::max() || queryCount == 0)
+    {
+        std::fprintf(stderr, "usage: %s [map size >= 8] [query count > 0] [worker thread count]\n", argv[0]);
+        return 1;
+    }
+
+    F_Threads::GetSingleton().RegisterCurrentThread(F_Threads::MainThreadId);
+
+    std::mt19937 random{ RandomSeed };
+    const Vector2i mapSize{ mapExtent, mapExtent };
+    std::vector<BenchmarkMap> maps;
+    maps.push_back(MakeOpenField(mapSize));
+    maps.push_back(MakeMaze(mapSize, random));
+    maps.push_back(MakeRoomsAndCorridors(mapSize, random));
+    maps.push_back(MakeNoisyCosts(mapSize, random));
+
+    std::vector<std::vector<Query>> queries;
+    for (const auto& map : maps)
+    {
+        queries.push_back(MakeQueries(map.CostDatas, queryCount, random));
+    }
+
+    std::printf("map %dx%d, %u queries per map, seed %u, search timing statistics %s\n",
+                mapExtent,
+                mapExtent,
+                queryCount,
+                RandomSeed,
+                G_Pathfinder::IsSearchTimingEnabled ? "on" : "off");
+    RunBenchmarks(0, maps, queries);
+    if (workerThreadCount > 0)
+    {
+        RunBenchmarks(workerThreadCount, maps, queries);
+    }
+    return 0;
+}
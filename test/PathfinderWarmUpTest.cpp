@@ -0,0 +1,144 @@
+//
+// Created by agent on 2026-10-18.
+//
+
+// G_Pathfinder::WarmUp() 이후 첫 질의들이 메모리를 할당하지 않는지(또는 정해진 수 이하로만 할당하는지) 확인하는 테스트.
+// 전역 operator new를 바꿔 현재 스레드의 할당 횟수를 세며, 실패하면 0이 아닌 값을 반환함.
+
+#include "F_Executor.h"
+#include "F_Threads.h"
+#include "G_Pathfinder.h"
+
+#include <godot_cpp/variant/vector2i.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace Core;
+using namespace godot;
+
+namespace
+{
+    thread_local bool IsCountingAllocations = false;
+    thread_local size_t AllocationCount = 0;
+
+    template<typename TFunction>
+    size_t CountAllocations(TFunction&& function)
+    {
+        AllocationCount = 0;
+        IsCountingAllocations = true;
+        function();
+        IsCountingAllocations = false;
+        return AllocationCount;
+    }
+
+    bool Check(const char* name, const size_t allocationCount, const size_t maxAllocationCount)
+    {
+        const auto isPassed = allocationCount <= maxAllocationCount;
+        std::printf("%-40s %zu allocations (max %zu) %s\n", name, allocationCount, maxAllocationCount, isPassed ? "ok" : "FAILED");
+        return isPassed;
+    }
+
+    void* Allocate(const size_t size) noexcept
+    {
+        if (IsCountingAllocations)
+        {
+            AllocationCount += 1;
+        }
+        return std::malloc(size == 0 ? 1 : size);
+    }
+}
+
+void* operator new(const size_t size)
+{
+    if (const auto pointer = Allocate(size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    std::free(pointer);
+}
+
+int main()
+{
+    F_Threads::GetSingleton().RegisterCurrentThread(F_Threads::MainThreadId);
+
+    F_Executor executor{ 0 };
+    F_EntityManager entityManager;
+    F_EventManager eventManager;
+    const F_MutableContext context{ entityManager, eventManager, executor, 1 };
+
+    // 가운데에 아래쪽 두 칸만 열린 벽을 두어, 벽을 넘는 질의는 맵 대부분을 확장하고 맵의 긴 변보다 긴 경로를 만듦.
+    constexpr int32_t MapExtent = 256;
+    const Vector2i mapSize{ MapExtent, MapExtent };
+    U_TiledDatas<uint32_t> costDatas;
+    costDatas.Resize(mapSize, 1);
+    for (int32_t y = 0; y < MapExtent - 2; ++y)
+    {
+        costDatas.GetDataAt(Vector2i{ MapExtent / 2, y }) = G_Pathfinder::ImpassableCost;
+    }
+
+    G_Pathfinder pathfinder;
+    pathfinder.WarmUp(context, mapSize);
+
+    auto isPassed = true;
+    isPassed &= Check("Pathfind (open side)",
+                      CountAllocations([&]
+                      {
+                          (void)pathfinder.Pathfind(costDatas, Vector2i{ 1, 1 }, Vector2i{ MapExtent / 2 - 2, MapExtent / 2 });
+                      }),
+                      0);
+    isPassed &= Check("PathfindBidirectional (open side)",
+                      CountAllocations([&]
+                      {
+                          (void)pathfinder.PathfindBidirectional(costDatas, Vector2i{ 1, 1 }, Vector2i{ MapExtent / 2 - 2, MapExtent / 2 });
+                      }),
+                      0);
+    // WarmUp()은 맵의 긴 변 길이만큼의 경로 버퍼를 잡으므로, 그보다 긴 우회 경로에서만 버퍼가 몇 번 커질 수 있음.
+    isPassed &= Check("Pathfind (around the wall)",
+                      CountAllocations([&]
+                      {
+                          (void)pathfinder.Pathfind(costDatas, Vector2i{ 1, 1 }, Vector2i{ MapExtent - 2, 1 });
+                      }),
+                      4);
+    isPassed &= Check("PathfindBidirectional (around the wall)",
+                      CountAllocations([&]
+                      {
+                          (void)pathfinder.PathfindBidirectional(costDatas, Vector2i{ 1, 3 }, Vector2i{ MapExtent - 2, 3 });
+                      }),
+                      4);
+
+    // ProcessPathRequests()는 탐색 외에 요청 목록들을 다루므로, 요청 수와 무관한 몇 번의 할당만 허용함.
+    isPassed &= Check("RequestPathfind + ProcessPathRequests",
+                      CountAllocations([&]
+                      {
+                          for (int32_t y = 0; y < 8; ++y)
+                          {
+                              (void)pathfinder.RequestPathfind(Vector2i{ 1, 1 + y }, Vector2i{ MapExtent - 2, 1 + y }, 0);
+                          }
+                          pathfinder.ProcessPathRequests(context, costDatas, std::chrono::seconds{ 10 });
+                      }),
+                      16);
+
+    return isPassed ? 0 : 1;
+}